@@ -7,36 +7,132 @@ std::string ASTPrinter::print(const Expr& expr) {
 	return result.str();
 }
 
-void ASTPrinter::visit(const UnaryExpr& expr) const {
+Value ASTPrinter::visit(const UnaryExpr& expr) const {
 	result << "(" << expr.op.lexeme << " ";
 	expr.operand->accept(*this);
 	result << ")";
+	return Value();
 }
 
-void ASTPrinter::visit(const BinaryExpr& expr) const {
+Value ASTPrinter::visit(const BinaryExpr& expr) const {
 	result << "( " << expr.op.lexeme << " ";
 	expr.left->accept(*this);
 	result << " ";
 	expr.right->accept(*this);
 	result << ")";
+	return Value();
 }
 
-void ASTPrinter::visit(const GroupingExpr& expr) const {
+Value ASTPrinter::visit(const GroupingExpr& expr) const {
 	result << "(group ";
 	expr.expr->accept(*this);
 	result << ")";
+	return Value();
 }
 
-void ASTPrinter::visit(const LiteralExpr& expr) const {
+Value ASTPrinter::visit(const LiteralExpr& expr) const {
 	result << expr.literal.lexeme;
+	return Value();
 }
 
-void ASTPrinter::visit(const VariableExpr& expr) const {
+Value ASTPrinter::visit(const VariableExpr& expr) const {
 	result << expr.name.lexeme;
+	return Value();
 }
 
-void ASTPrinter::visit(const AssignmentExpr& expr) const {
+Value ASTPrinter::visit(const AssignmentExpr& expr) const {
 	result << "(set " << expr.name.lexeme << " ";
 	expr.value->accept(*this);
 	result << ")";
+	return Value();
+}
+
+Value ASTPrinter::visit(const ArrayPushExpr& expr) const {
+	result << "(push " << expr.name.lexeme << " ";
+	expr.value->accept(*this);
+	result << ")";
+	return Value();
+}
+
+Value ASTPrinter::visit(const ArrayAccessExpr& expr) const {
+	result << "(get " << expr.name.lexeme << " ";
+	expr.index->accept(*this);
+	result << ")";
+	return Value();
+}
+
+Value ASTPrinter::visit(const ArraySetExpr& expr) const {
+	result << "(put " << expr.name.lexeme << " ";
+	expr.index->accept(*this);
+	result << " ";
+	expr.value->accept(*this);
+	result << ")";
+	return Value();
+}
+
+Value ASTPrinter::visit(const InputExpr&) const {
+	result << "input";
+	return Value();
+}
+
+//	the optimizer's nodes print the expression they stand for
+
+Value ASTPrinter::visit(const IncrementExpr& expr) const {
+	return expr.original->accept(*this);
+}
+
+Value ASTPrinter::visit(const CompareLocalExpr& expr) const {
+	return expr.original->accept(*this);
+}
+
+Value ASTPrinter::visit(const CompareAdjacentExpr& expr) const {
+	return expr.original->accept(*this);
+}
+
+Value ASTPrinter::visit(const TempExpr& expr) const {
+	return expr.original->accept(*this);
+}
+
+Value ASTPrinter::visit(const CaptureExpr& expr) const {
+	return expr.expr->accept(*this);
+}
+
+Value ASTPrinter::visit(const DeepExpr& expr) const {
+	return expr.expr->accept(*this);
+}
+
+Value ASTPrinter::visit(const CallExpr& expr) const {
+	result << "(" << expr.name.lexeme;
+	for (const Token& array : expr.arrays)
+		result << " " << array.lexeme;
+	for (const auto& argument : expr.arguments)
+	{
+		result << " ";
+		argument->accept(*this);
+	}
+	result << ")";
+	return Value();
+}
+
+Value ASTPrinter::visit(const MapAccessExpr& expr) const {
+	result << "(get " << expr.name.lexeme << " ";
+	expr.key->accept(*this);
+	result << ")";
+	return Value();
+}
+
+Value ASTPrinter::visit(const MapSetExpr& expr) const {
+	result << "(put " << expr.name.lexeme << " ";
+	expr.key->accept(*this);
+	result << " ";
+	expr.value->accept(*this);
+	result << ")";
+	return Value();
+}
+
+Value ASTPrinter::visit(const MapContainsExpr& expr) const {
+	result << "(in " << expr.name.lexeme << " ";
+	expr.key->accept(*this);
+	result << ")";
+	return Value();
 }
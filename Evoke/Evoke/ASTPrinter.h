@@ -1,23 +1,36 @@
-#pragma once
-#include "expr.h"
-#include <sstream>
-#include <string>
-
-class ASTPrinter : public ExprVisitor {
-public:
-	std::string print(const Expr& expr);
-
-	void visit(const UnaryExpr& expr) const override;
-	void visit(const BinaryExpr& expr) const override;
-	void visit(const GroupingExpr& expr) const override;
-	void visit(const LiteralExpr& expr) const override;
-
-	void visit(const VariableExpr& expr) const override;
-	void visit(const AssignmentExpr& expr) const override;
-	void visit(const ArrayPushExpr& expr) const override {};
-	void visit(const ArrayAccessExpr& expr) const override {};
-	void visit(const ArraySetExpr& expr) const override {};
-
-private:
-	mutable std::ostringstream result;
-};
+#pragma once
+#include "expr.h"
+#include <sstream>
+#include <string>
+
+//	prints an expression as nested lists, the visits write into result and
+//	return nothing
+class ASTPrinter : public ValueVisitor {
+public:
+	std::string print(const Expr& expr);
+
+	Value visit(const UnaryExpr& expr) const override;
+	Value visit(const BinaryExpr& expr) const override;
+	Value visit(const GroupingExpr& expr) const override;
+	Value visit(const LiteralExpr& expr) const override;
+
+	Value visit(const VariableExpr& expr) const override;
+	Value visit(const AssignmentExpr& expr) const override;
+	Value visit(const ArrayPushExpr& expr) const override;
+	Value visit(const ArrayAccessExpr& expr) const override;
+	Value visit(const ArraySetExpr& expr) const override;
+	Value visit(const InputExpr& expr) const override;
+	Value visit(const IncrementExpr& expr) const override;
+	Value visit(const CompareLocalExpr& expr) const override;
+	Value visit(const CompareAdjacentExpr& expr) const override;
+	Value visit(const TempExpr& expr) const override;
+	Value visit(const CaptureExpr& expr) const override;
+	Value visit(const DeepExpr& expr) const override;
+	Value visit(const CallExpr& expr) const override;
+	Value visit(const MapAccessExpr& expr) const override;
+	Value visit(const MapSetExpr& expr) const override;
+	Value visit(const MapContainsExpr& expr) const override;
+
+private:
+	mutable std::ostringstream result;
+};
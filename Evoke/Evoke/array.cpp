@@ -0,0 +1,286 @@
+#include "array.h"
+#include "kernels.h"
+#include "sort.h"
+#include <algorithm>
+
+Array::Array() : storage(std::make_shared<Storage>()) {}
+
+Array::Array(const Array& other) : storage(std::make_shared<Storage>())
+{
+	const Storage& from = *other.storage;
+	size_t count = other.size();
+	storage->packed = from.packed;
+	if (from.packed)
+		storage->numbers.assign(from.numbers.data() + other.offset, count);
+	else
+		storage->values.assign(from.values.begin() + other.offset, from.values.begin() + other.offset + count);
+}
+
+Array& Array::operator=(const Array& other)
+{
+	if (this != &other)
+		*this = Array(other);
+	return *this;
+}
+
+Array Array::view(size_t first, size_t count) const
+{
+	return Array(storage, offset + first, count);
+}
+
+void Array::detach()
+{
+	if (isView())
+		*this = Array(*this);
+}
+
+bool Array::getNumber(size_t index, double& number) const
+{
+	const Storage& elements = *storage;
+	index += offset;
+	if (elements.packed)
+	{
+		number = elements.numbers[index];
+		return true;
+	}
+	return packable(elements.values[index], number);
+}
+
+void Array::set(size_t index, const Value& value)
+{
+	Storage& elements = *storage;
+	index += offset;
+	if (elements.packed)
+	{
+		if (packable(value, elements.numbers[index]))
+			return;
+		elements.box();
+	}
+	elements.values[index] = value;
+}
+
+void Array::push(const Value& value)
+{
+	detach();
+	Storage& elements = *storage;
+	if (elements.packed)
+	{
+		double number;
+		if (packable(value, number))
+		{
+			elements.numbers.push_back(number);
+			return;
+		}
+		elements.box();
+	}
+	elements.values.push_back(value);
+}
+
+void Array::reserve(size_t count)
+{
+	detach();
+	if (storage->packed)
+		storage->numbers.reserve(count);
+	else
+		storage->values.reserve(count);
+}
+
+bool Array::packable(const Value& value, double& number)
+{
+	if (value.getType() == Type::DOUBLE || (value.getType() == Type::INTEGER && exactDouble(value.getInteger())))
+	{
+		number = value.getDouble();
+		return true;
+	}
+	return false;
+}
+
+void Array::Storage::box()
+{
+	values.reserve(numbers.size() + 1);
+	for (size_t i = 0; i < numbers.size(); i++)
+		values.emplace_back(numbers[i]);
+	numbers.release();
+	packed = false;
+}
+
+bool Array::repack()
+{
+	Storage& elements = *storage;
+	if (elements.packed)
+		return true;
+	std::vector<double> packedNumbers(elements.values.size());
+	for (size_t i = 0; i < elements.values.size(); i++)
+	{
+		if (!packable(elements.values[i], packedNumbers[i]))
+			return false;
+	}
+	elements.numbers.assign(std::move(packedNumbers));
+	elements.values = std::vector<Value>();
+	elements.packed = true;
+	return true;
+}
+
+bool Array::readNumbers(const double*& first, std::vector<double>& scratch) const
+{
+	if (storage->packed)
+	{
+		first = data();
+		return true;
+	}
+	scratch.clear();
+	size_t count = size();
+	for (size_t i = 0; i < count; i++)
+	{
+		//	integers too large to pack are rounded, the kernels work in doubles
+		const Value& value = storage->values[offset + i];
+		if (!value.isNumber())
+			return false;
+		scratch.push_back(value.getDouble());
+	}
+	first = scratch.data();
+	return true;
+}
+
+void Array::fill(const Value& value)
+{
+	Storage& elements = *storage;
+	size_t count = size();
+	double number;
+	if (packable(value, number))
+	{
+		//	a view can't repack elements it doesn't cover
+		if (!elements.packed && !isView())
+		{
+			elements.values = std::vector<Value>();
+			elements.numbers.resize(count);
+			elements.packed = true;
+		}
+		if (elements.packed)
+		{
+			fillNumbers(data(), count, number);
+			return;
+		}
+	}
+	if (elements.packed)
+		elements.box();
+	if (isView())
+		std::fill(elements.values.begin() + offset, elements.values.begin() + offset + count, value);
+	else
+		elements.values.assign(count, value);
+}
+
+void Array::assign(size_t count, const Value& value)
+{
+	//	new elements, views of the old ones keep them
+	storage = std::make_shared<Storage>();
+	offset = 0;
+	length = whole;
+	double number;
+	if (packable(value, number))
+	{
+		storage->numbers.resize(count);
+		fillNumbers(storage->numbers.data(), count, number);
+	}
+	else
+	{
+		storage->values.assign(count, value);
+		storage->packed = false;
+	}
+}
+
+void Array::assign(std::vector<double>&& numbers)
+{
+	storage = std::make_shared<Storage>();
+	offset = 0;
+	length = whole;
+	storage->numbers.assign(std::move(numbers));
+}
+
+void Array::assign(std::unique_ptr<Mapping> file)
+{
+	storage = std::make_shared<Storage>();
+	offset = 0;
+	length = whole;
+	storage->numbers.assign(std::move(file));
+}
+
+bool Array::sort(WorkerPool* pool)
+{
+	size_t count = size();
+	if (repack())
+	{
+		sortNumbers(data(), count, pool);
+		return true;
+	}
+	Value* first = storage->values.data() + offset;
+	bool strings = true;
+	bool numbers = true;
+	for (size_t i = 0; i < count; i++)
+	{
+		strings = strings && first[i].getType() == Type::STRING;
+		numbers = numbers && first[i].isNumber();
+	}
+	if (strings)
+		sortStrings(first, count, pool);
+	else if (numbers)
+		sortNumberValues(first, count, pool);
+	return strings || numbers;
+}
+
+void Array::Numbers::reserve(size_t capacity)
+{
+	own();
+	owned.reserve(capacity);
+	first = owned.data();
+}
+
+void Array::Numbers::resize(size_t size)
+{
+	own();
+	owned.resize(size);
+	first = owned.data();
+	count = size;
+}
+
+void Array::Numbers::assign(const double* from, size_t size)
+{
+	file.reset();
+	owned.assign(from, from + size);
+	first = owned.data();
+	count = size;
+}
+
+void Array::Numbers::assign(std::vector<double>&& numbers)
+{
+	file.reset();
+	owned = std::move(numbers);
+	first = owned.data();
+	count = owned.size();
+}
+
+void Array::Numbers::assign(std::unique_ptr<Mapping> mapping)
+{
+	owned = std::vector<double>();
+	file = std::move(mapping);
+	first = reinterpret_cast<double*>(file->data());
+	count = file->size() / sizeof(double);
+}
+
+void Array::Numbers::release()
+{
+	file.reset();
+	owned = std::vector<double>();
+	first = nullptr;
+	count = 0;
+}
+
+//	the mapped numbers, with whatever was written to them, into the vector
+void Array::Numbers::own()
+{
+	if (file == nullptr)
+		return;
+	owned.assign(first, first + count);
+	file.reset();
+	first = owned.data();
+}
@@ -0,0 +1,141 @@
+#pragma once
+#include <vector>
+#include <algorithm>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include "value.h"
+#include "mapping.h"
+
+class WorkerPool;
+
+//	elements of a var[] array. as long as every element is a number they are
+//	kept packed as doubles, which the built-in array functions run over
+//	directly. integers are packed as the equal double, storing one too large
+//	for that or anything else moves the array to boxed values
+//	the elements live in a storage that views share: a view is a range of
+//	another array's elements, reads and writes go to those elements. a view
+//	that is pushed onto or resized copies its range out first, and a copy of
+//	a view is an ordinary array
+//	numbers loaded from a binary file stay in a mapping of the file until the
+//	length changes, writes to them don't reach the file
+class Array
+{
+public:
+	Array();
+	Array(const Array& other);
+	Array& operator=(const Array& other);
+	Array(Array&& other) = default;
+	Array& operator=(Array&& other) = default;
+
+	//	count elements from first on, first + count must not be past the end
+	Array view(size_t first, size_t count) const;
+	bool isView() const { return length != whole; }
+	//	a view of these elements or the array of this view is alive
+	bool isShared() const { return storage.use_count() > 1; }
+
+	//	a view only reaches as far as the elements it shares still go
+	size_t size() const
+	{
+		size_t total = storage->size();
+		return offset < total ? std::min(length, total - offset) : 0;
+	}
+	bool isPacked() const { return storage->packed; }
+
+	Value get(size_t index) const
+	{
+		const Storage& elements = *storage;
+		index += offset;
+		return elements.packed ? Value(elements.numbers[index]) : elements.values[index];
+	}
+	//	false if the element isn't a number
+	bool getNumber(size_t index, double& number) const;
+	void set(size_t index, const Value& value);
+	void push(const Value& value);
+	void reserve(size_t count);
+	//	false if value can't be stored packed
+	static bool packable(const Value& value, double& number);
+
+	//	the packed elements, only while isPacked()
+	double* data() { return storage->numbers.data() + offset; }
+	const double* data() const { return storage->numbers.data() + offset; }
+	//	packs a boxed array whose elements are all numbers again, false if
+	//	one of them isn't. a view packs all the elements it shares
+	bool repack();
+	//	the elements as numbers, packed or gathered into scratch, false if
+	//	one of them isn't a number
+	bool readNumbers(const double*& first, std::vector<double>& scratch) const;
+	//	every element set to value, the length stays
+	void fill(const Value& value);
+	//	count elements, each one value
+	void assign(size_t count, const Value& value);
+	//	the numbers as the elements
+	void assign(std::vector<double>&& numbers);
+	//	the doubles stored in the mapped file as the elements, its size must be
+	//	a multiple of a double's
+	void assign(std::unique_ptr<Mapping> file);
+	//	ascending, numbers packed or, with integers too large to pack, in place,
+	//	strings in place. false if the array mixes types that don't compare. a
+	//	pool, if given, sorts large arrays in parallel
+	bool sort(WorkerPool* pool);
+
+private:
+	//	packed numbers in a vector of their own or in a mapped file, which
+	//	is copied into the vector before the length changes
+	class Numbers
+	{
+	public:
+		double& operator[](size_t index) { return first[index]; }
+		double operator[](size_t index) const { return first[index]; }
+		double* data() { return first; }
+		const double* data() const { return first; }
+		size_t size() const { return count; }
+
+		void push_back(double number)
+		{
+			if (file != nullptr)
+				own();
+			owned.push_back(number);
+			first = owned.data();
+			count = owned.size();
+		}
+		void reserve(size_t capacity);
+		void resize(size_t size);
+		void assign(const double* from, size_t size);
+		void assign(std::vector<double>&& numbers);
+		void assign(std::unique_ptr<Mapping> mapping);
+		//	empty, with the memory given back
+		void release();
+
+	private:
+		void own();
+
+		double* first = nullptr;
+		size_t count = 0;
+		std::vector<double> owned;
+		std::unique_ptr<Mapping> file;
+	};
+
+	struct Storage
+	{
+		bool packed = true;
+		Numbers numbers;
+		std::vector<Value> values;
+
+		size_t size() const { return packed ? numbers.size() : values.size(); }
+		void box();
+	};
+
+	//	length of an array that isn't a view, all of its storage
+	static const size_t whole = SIZE_MAX;
+
+	//	a view takes a copy of its range and stops sharing it
+	void detach();
+
+	Array(std::shared_ptr<Storage> storage, size_t offset, size_t length)
+		: storage(std::move(storage)), offset(offset), length(length) {}
+
+	std::shared_ptr<Storage> storage;
+	size_t offset = 0;
+	size_t length = whole;
+};
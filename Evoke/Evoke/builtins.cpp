@@ -0,0 +1,34 @@
+#include "builtins.h"
+
+static const BuiltinInfo builtins[] = {
+	{ "len", Builtin::LEN, 1, 0, false, false, false },
+	{ "sum", Builtin::SUM, 1, 0, false, false, false },
+	{ "min", Builtin::MIN, 1, 0, false, false, false },
+	{ "max", Builtin::MAX, 1, 0, false, false, false },
+	{ "dot", Builtin::DOT, 2, 0, false, false, false },
+	{ "fill", Builtin::FILL, 1, 1, true, false, false },
+	{ "scale", Builtin::SCALE, 1, 1, true, false, false },
+	{ "offset", Builtin::OFFSET, 1, 1, true, false, false },
+	{ "copy", Builtin::COPY, 2, 0, true, true, false },
+	{ "sort", Builtin::SORT, 1, 0, true, false, false },
+	{ "reserve", Builtin::RESERVE, 1, 1, true, false, false },
+	{ "load", Builtin::LOAD, 1, 1, true, true, true },
+	{ "save", Builtin::SAVE, 1, 1, false, false, true },
+	{ "loadbinary", Builtin::LOAD_BINARY, 1, 1, true, true, true },
+	{ "savebinary", Builtin::SAVE_BINARY, 1, 1, false, false, true },
+};
+
+const BuiltinInfo* findBuiltin(const std::string& name)
+{
+	for (const auto& info : builtins)
+	{
+		if (name == info.name)
+			return &info;
+	}
+	return nullptr;
+}
+
+const BuiltinInfo& builtinInfo(Builtin builtin)
+{
+	return builtins[static_cast<int>(builtin)];
+}
@@ -0,0 +1,29 @@
+#pragma once
+#include <string>
+
+//	functions built into the language, called as name(arguments)
+//	array arguments come first and are bare array names, the others are
+//	expressions
+enum class Builtin
+{
+	LEN, SUM, MIN, MAX, DOT, FILL, SCALE, OFFSET, COPY, SORT, RESERVE,
+	LOAD, SAVE, LOAD_BINARY, SAVE_BINARY,
+};
+
+struct BuiltinInfo
+{
+	const char* name;
+	Builtin builtin;
+	int arrays;
+	int scalars;
+	//	changes the elements or the storage of its first array
+	bool writes;
+	//	can change the length of its first array
+	bool resizes;
+	//	reads or writes the file its scalar names
+	bool files;
+};
+
+//	nullptr if there is no built-in function of that name
+const BuiltinInfo* findBuiltin(const std::string& name);
+const BuiltinInfo& builtinInfo(Builtin builtin);
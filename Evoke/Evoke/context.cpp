@@ -0,0 +1,30 @@
+#include "context.h"
+
+Context::Context(std::string& sink, std::string_view text) : output(sink)
+{
+	input.setText(text);
+}
+
+void Context::error(int line, const std::string& message)
+{
+	report(line, "", message);
+}
+
+void Context::error(const Token& token, const std::string& message)
+{
+	if (token.type == END_OF_FILE)
+		report(token.line, " at end", message);
+	else
+		report(token.line, " at '" + token.lexeme + "'", message);
+}
+
+void Context::runtimeError(Output& out, const Token& token, const std::string& message)
+{
+	out.write("[line " + std::to_string(token.line) + "] Error: " + message + "\n");
+}
+
+void Context::report(int line, const std::string& location, const std::string& message)
+{
+	output.write("[line " + std::to_string(line) + "] Error" + location + ": " + message + "\n");
+	hadError = true;
+}
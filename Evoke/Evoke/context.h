@@ -0,0 +1,34 @@
+#pragma once
+#include <string>
+#include "token.h"
+#include "output.h"
+#include "input.h"
+
+//	state one script run reports to and reads from: the error flags and the
+//	streams behind print and input. the scanner, parser and interpreter only
+//	see the context they were given, so separate contexts can run scripts on
+//	separate threads without sharing anything
+class Context
+{
+public:
+	//	standard output and standard input
+	Context() = default;
+	//	collects what is printed in sink, reads input expressions from text
+	//	(which has to outlive the context)
+	explicit Context(std::string& sink, std::string_view text = std::string_view());
+	Context(const Context&) = delete;
+	Context& operator=(const Context&) = delete;
+
+	void error(int line, const std::string& message);
+	void error(const Token& token, const std::string& message);
+	//	runtime errors go to the output the failing interpreter prints to
+	static void runtimeError(Output& out, const Token& token, const std::string& message);
+
+	bool hadError = false;
+	bool hadRuntimeError = false;
+	Output output;
+	Input input;
+
+private:
+	void report(int line, const std::string& location, const std::string& message);
+};
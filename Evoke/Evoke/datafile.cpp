@@ -0,0 +1,145 @@
+#include "datafile.h"
+#include "numbers.h"
+#include "output.h"
+#include "pool.h"
+#include <charconv>
+#include <cstdio>
+
+//	text smaller than this is parsed by the calling thread alone
+static const size_t textChunk = 1 << 20;
+
+DataFile loadBinary(const std::string& path, Array& array)
+{
+	auto file = std::make_unique<Mapping>();
+	if (!file->open(path))
+		return DataFile::FAILED;
+	if (file->size() % sizeof(double) != 0)
+		return DataFile::MALFORMED;
+	array.assign(std::move(file));
+	return DataFile::OK;
+}
+
+static bool separator(char c)
+{
+	return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == ',';
+}
+
+//	appends the numbers in text, false if something else is in it
+static bool parseNumbers(const char* text, const char* end, std::vector<double>& numbers)
+{
+	while (true)
+	{
+		while (text < end && separator(*text))
+			text++;
+		if (text == end)
+			return true;
+		double number;
+		std::from_chars_result result = std::from_chars(text, end, number);
+		if (result.ec != std::errc() || (result.ptr < end && !separator(*result.ptr)))
+			return false;
+		numbers.push_back(number);
+		text = result.ptr;
+	}
+}
+
+DataFile loadText(const std::string& path, Array& array, WorkerPool* pool)
+{
+	Mapping file;
+	if (!file.open(path))
+		return DataFile::FAILED;
+	const char* text = file.data();
+	size_t size = file.size();
+
+	//	chunks end after a separator, so no number is cut in two
+	std::vector<size_t> bounds{ 0 };
+	while (size - bounds.back() > textChunk)
+	{
+		size_t bound = bounds.back() + textChunk;
+		while (bound < size && !separator(text[bound - 1]))
+			bound++;
+		bounds.push_back(bound);
+	}
+	if (bounds.back() < size)
+		bounds.push_back(size);
+
+	size_t chunks = bounds.size() - 1;
+	std::vector<std::vector<double>> parts(chunks);
+	std::vector<char> parsed(chunks, 0);
+	auto parse = [&](size_t chunk, unsigned)
+	{
+		//	about one number per 8 bytes of text
+		parts[chunk].reserve((bounds[chunk + 1] - bounds[chunk]) / 8);
+		parsed[chunk] = parseNumbers(text + bounds[chunk], text + bounds[chunk + 1], parts[chunk]);
+	};
+	if (pool != nullptr && chunks > 1)
+		pool->run(chunks, parse);
+	else
+	{
+		for (size_t chunk = 0; chunk < chunks; chunk++)
+			parse(chunk, 0);
+	}
+
+	size_t count = 0;
+	for (size_t chunk = 0; chunk < chunks; chunk++)
+	{
+		if (!parsed[chunk])
+			return DataFile::MALFORMED;
+		count += parts[chunk].size();
+	}
+	if (chunks == 1)
+	{
+		array.assign(std::move(parts[0]));
+		return DataFile::OK;
+	}
+	std::vector<double> numbers;
+	numbers.reserve(count);
+	for (const auto& part : parts)
+		numbers.insert(numbers.end(), part.begin(), part.end());
+	array.assign(std::move(numbers));
+	return DataFile::OK;
+}
+
+//	truncating the file in place would pull the pages out from under a mapping
+template <typename Write>
+static DataFile save(const std::string& path, Write write)
+{
+	std::string temporary = path + ".tmp";
+	{
+		Output file;
+		if (!file.open(temporary))
+			return DataFile::FAILED;
+		write(file);
+	}
+#ifdef _WIN32
+	//	rename doesn't replace a file there
+	std::remove(path.c_str());
+#endif
+	if (std::rename(temporary.c_str(), path.c_str()) != 0)
+	{
+		std::remove(temporary.c_str());
+		return DataFile::FAILED;
+	}
+	return DataFile::OK;
+}
+
+DataFile saveBinary(const std::string& path, const double* numbers, size_t count)
+{
+	return save(path, [&](Output& file)
+	{
+		file.write(reinterpret_cast<const char*>(numbers), count * sizeof(double));
+	});
+}
+
+DataFile saveText(const std::string& path, const double* numbers, size_t count)
+{
+	return save(path, [&](Output& file)
+	{
+		char text[maxNumberLength + 1];
+		for (size_t i = 0; i < count; i++)
+		{
+			size_t length = formatNumber(numbers[i], text);
+			text[length] = '\n';
+			file.write(text, length + 1);
+		}
+	});
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include <string>
+#include <cstddef>
+#include "array.h"
+
+class WorkerPool;
+
+//	files of numbers behind the load and save built-ins. a binary file holds
+//	the doubles as they are in memory, a text file numbers separated by
+//	whitespace or commas
+enum class DataFile
+{
+	OK,
+	//	can't be opened, read or created
+	FAILED,
+	//	a binary file whose size isn't a multiple of a double's, or a text
+	//	file with something other than a number in it
+	MALFORMED,
+};
+
+//	the array takes the mapped file as its elements, nothing is copied until
+//	the length changes
+DataFile loadBinary(const std::string& path, Array& array);
+//	large files are cut into chunks at separators, a pool, if given, parses
+//	them in parallel
+DataFile loadText(const std::string& path, Array& array, WorkerPool* pool);
+//	the saves write next to the file and rename over it, an array still mapped
+//	from the old one keeps its elements
+DataFile saveBinary(const std::string& path, const double* numbers, size_t count);
+//	one number per line, written so it reads back as the same double
+DataFile saveText(const std::string& path, const double* numbers, size_t count);
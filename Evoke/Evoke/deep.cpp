@@ -0,0 +1,278 @@
+#include "deep.h"
+#include <vector>
+
+//	moves every child of expr into the worklist
+static void releaseChildren(Expr& expr, std::vector<std::unique_ptr<Expr>>& exprs)
+{
+	if (UnaryExpr* unary = dynamic_cast<UnaryExpr*>(&expr))
+	{
+		exprs.push_back(std::move(unary->operand));
+	}
+	else if (BinaryExpr* binary = dynamic_cast<BinaryExpr*>(&expr))
+	{
+		exprs.push_back(std::move(binary->left));
+		exprs.push_back(std::move(binary->right));
+	}
+	else if (GroupingExpr* grouping = dynamic_cast<GroupingExpr*>(&expr))
+	{
+		exprs.push_back(std::move(grouping->expr));
+	}
+	else if (AssignmentExpr* assignment = dynamic_cast<AssignmentExpr*>(&expr))
+	{
+		exprs.push_back(std::move(assignment->value));
+	}
+	else if (ArrayPushExpr* push = dynamic_cast<ArrayPushExpr*>(&expr))
+	{
+		exprs.push_back(std::move(push->value));
+	}
+	else if (ArrayAccessExpr* access = dynamic_cast<ArrayAccessExpr*>(&expr))
+	{
+		exprs.push_back(std::move(access->index));
+	}
+	else if (ArraySetExpr* set = dynamic_cast<ArraySetExpr*>(&expr))
+	{
+		exprs.push_back(std::move(set->index));
+		exprs.push_back(std::move(set->value));
+	}
+	else if (IncrementExpr* increment = dynamic_cast<IncrementExpr*>(&expr))
+	{
+		exprs.push_back(std::move(increment->original));
+	}
+	else if (CompareLocalExpr* compare = dynamic_cast<CompareLocalExpr*>(&expr))
+	{
+		exprs.push_back(std::move(compare->original));
+	}
+	else if (CompareAdjacentExpr* compare = dynamic_cast<CompareAdjacentExpr*>(&expr))
+	{
+		exprs.push_back(std::move(compare->original));
+	}
+	else if (TempExpr* temp = dynamic_cast<TempExpr*>(&expr))
+	{
+		exprs.push_back(std::move(temp->original));
+	}
+	else if (CaptureExpr* capture = dynamic_cast<CaptureExpr*>(&expr))
+	{
+		exprs.push_back(std::move(capture->expr));
+	}
+	else if (CallExpr* call = dynamic_cast<CallExpr*>(&expr))
+	{
+		for (auto& argument : call->arguments)
+			exprs.push_back(std::move(argument));
+	}
+	else if (MapAccessExpr* access = dynamic_cast<MapAccessExpr*>(&expr))
+	{
+		exprs.push_back(std::move(access->key));
+	}
+	else if (MapSetExpr* set = dynamic_cast<MapSetExpr*>(&expr))
+	{
+		exprs.push_back(std::move(set->key));
+		exprs.push_back(std::move(set->value));
+	}
+	else if (MapContainsExpr* contains = dynamic_cast<MapContainsExpr*>(&expr))
+	{
+		exprs.push_back(std::move(contains->key));
+	}
+	else if (DeepExpr* deep = dynamic_cast<DeepExpr*>(&expr))
+	{
+		deep->ops.clear();
+		exprs.push_back(std::move(deep->expr));
+	}
+}
+
+static void releaseChildren(Stmt& stmt, std::vector<std::unique_ptr<Stmt>>& stmts, std::vector<std::unique_ptr<Expr>>& exprs)
+{
+	if (PrintStmt* print = dynamic_cast<PrintStmt*>(&stmt))
+	{
+		exprs.push_back(std::move(print->expr));
+	}
+	else if (ExpressionStmt* expression = dynamic_cast<ExpressionStmt*>(&stmt))
+	{
+		exprs.push_back(std::move(expression->expr));
+	}
+	else if (ByteStmt* byte = dynamic_cast<ByteStmt*>(&stmt))
+	{
+		exprs.push_back(std::move(byte->initializer));
+	}
+	else if (ArrayStmt* array = dynamic_cast<ArrayStmt*>(&stmt))
+	{
+		for (auto& element : array->elements)
+			exprs.push_back(std::move(element));
+		exprs.push_back(std::move(array->count));
+		exprs.push_back(std::move(array->first));
+		exprs.push_back(std::move(array->last));
+	}
+	else if (BlockStmt* block = dynamic_cast<BlockStmt*>(&stmt))
+	{
+		for (auto& statement : block->stmts)
+			stmts.push_back(std::move(statement));
+	}
+	else if (IfStmt* ifStmt = dynamic_cast<IfStmt*>(&stmt))
+	{
+		exprs.push_back(std::move(ifStmt->condition));
+		stmts.push_back(std::move(ifStmt->thenBranch));
+		stmts.push_back(std::move(ifStmt->elseBranch));
+	}
+	else if (WhileStmt* whileStmt = dynamic_cast<WhileStmt*>(&stmt))
+	{
+		exprs.push_back(std::move(whileStmt->condition));
+		stmts.push_back(std::move(whileStmt->body));
+		if (whileStmt->range != nullptr)
+			exprs.push_back(std::move(whileStmt->range->limit));
+		for (auto& hoisted : whileStmt->hoisted)
+			exprs.push_back(std::move(hoisted.expr));
+	}
+	else if (ParallelStmt* parallel = dynamic_cast<ParallelStmt*>(&stmt))
+	{
+		exprs.push_back(std::move(parallel->from));
+		exprs.push_back(std::move(parallel->to));
+		stmts.push_back(std::move(parallel->body));
+	}
+	else if (DeepStmt* deep = dynamic_cast<DeepStmt*>(&stmt))
+	{
+		stmts.push_back(std::move(deep->stmt));
+	}
+	else if (SubscribedStmt* subscribed = dynamic_cast<SubscribedStmt*>(&stmt))
+	{
+		stmts.push_back(std::move(subscribed->stmt));
+	}
+	else if (EvokeStmt* evoke = dynamic_cast<EvokeStmt*>(&stmt))
+	{
+		exprs.push_back(std::move(evoke->condition));
+	}
+	else if (DeleteStmt* deleteStmt = dynamic_cast<DeleteStmt*>(&stmt))
+	{
+		exprs.push_back(std::move(deleteStmt->key));
+	}
+}
+
+void dismantle(std::unique_ptr<Expr> expr)
+{
+	std::vector<std::unique_ptr<Expr>> exprs;
+	exprs.push_back(std::move(expr));
+	while (!exprs.empty())
+	{
+		std::unique_ptr<Expr> node = std::move(exprs.back());
+		exprs.pop_back();
+		if (node != nullptr)
+			releaseChildren(*node, exprs);
+	}
+}
+
+void dismantle(std::unique_ptr<Stmt> stmt)
+{
+	std::vector<std::unique_ptr<Stmt>> stmts;
+	std::vector<std::unique_ptr<Expr>> exprs;
+	stmts.push_back(std::move(stmt));
+	while (!stmts.empty())
+	{
+		std::unique_ptr<Stmt> node = std::move(stmts.back());
+		stmts.pop_back();
+		if (node != nullptr)
+			releaseChildren(*node, stmts, exprs);
+	}
+	for (auto& expr : exprs)
+		dismantle(std::move(expr));
+}
+
+//	flattens the tree into post-order with an explicit stack
+//	grouping has no step of its own, it only passes its operand through
+DeepExpr::DeepExpr(std::unique_ptr<Expr> expr) : expr(std::move(expr))
+{
+	//	a node is pushed once to schedule its children and once more, marked,
+	//	to emit its own step after them
+	struct Pending
+	{
+		const Expr* node;
+		Step step;
+		bool emit;
+	};
+
+	std::vector<Pending> pending;
+	pending.push_back({ this->expr.get(), Step::EVALUATE, false });
+	while (!pending.empty())
+	{
+		Pending item = pending.back();
+		pending.pop_back();
+		if (item.emit)
+		{
+			ops.push_back({ item.step, item.node });
+			continue;
+		}
+
+		const Expr* node = item.node;
+		//	children are pushed in reverse so they come off the stack in order
+		if (const UnaryExpr* unary = dynamic_cast<const UnaryExpr*>(node))
+		{
+			pending.push_back({ node, Step::UNARY, true });
+			pending.push_back({ unary->operand.get(), Step::EVALUATE, false });
+		}
+		else if (const BinaryExpr* binary = dynamic_cast<const BinaryExpr*>(node))
+		{
+			pending.push_back({ node, Step::BINARY, true });
+			pending.push_back({ binary->right.get(), Step::EVALUATE, false });
+			pending.push_back({ binary->left.get(), Step::EVALUATE, false });
+		}
+		else if (const GroupingExpr* grouping = dynamic_cast<const GroupingExpr*>(node))
+		{
+			pending.push_back({ grouping->expr.get(), Step::EVALUATE, false });
+		}
+		else if (const AssignmentExpr* assignment = dynamic_cast<const AssignmentExpr*>(node))
+		{
+			pending.push_back({ node, Step::ASSIGN, true });
+			pending.push_back({ assignment->value.get(), Step::EVALUATE, false });
+		}
+		else if (const ArrayPushExpr* push = dynamic_cast<const ArrayPushExpr*>(node))
+		{
+			pending.push_back({ node, Step::PUSH, true });
+			pending.push_back({ push->value.get(), Step::EVALUATE, false });
+		}
+		else if (const ArrayAccessExpr* access = dynamic_cast<const ArrayAccessExpr*>(node))
+		{
+			pending.push_back({ node, Step::ACCESS, true });
+			pending.push_back({ access->index.get(), Step::EVALUATE, false });
+		}
+		else if (const ArraySetExpr* set = dynamic_cast<const ArraySetExpr*>(node))
+		{
+			pending.push_back({ node, Step::SET, true });
+			pending.push_back({ set->value.get(), Step::EVALUATE, false });
+			pending.push_back({ node, Step::INDEX, true });
+			pending.push_back({ set->index.get(), Step::EVALUATE, false });
+		}
+		else if (const CallExpr* call = dynamic_cast<const CallExpr*>(node))
+		{
+			pending.push_back({ node, Step::CALL, true });
+			for (size_t i = call->arguments.size(); i-- > 0;)
+				pending.push_back({ call->arguments[i].get(), Step::EVALUATE, false });
+		}
+		else if (const MapAccessExpr* access = dynamic_cast<const MapAccessExpr*>(node))
+		{
+			pending.push_back({ node, Step::MAP_ACCESS, true });
+			pending.push_back({ access->key.get(), Step::EVALUATE, false });
+		}
+		else if (const MapSetExpr* set = dynamic_cast<const MapSetExpr*>(node))
+		{
+			pending.push_back({ node, Step::MAP_SET, true });
+			pending.push_back({ set->value.get(), Step::EVALUATE, false });
+			pending.push_back({ set->key.get(), Step::EVALUATE, false });
+		}
+		else if (const MapContainsExpr* contains = dynamic_cast<const MapContainsExpr*>(node))
+		{
+			pending.push_back({ node, Step::MAP_CONTAINS, true });
+			pending.push_back({ contains->key.get(), Step::EVALUATE, false });
+		}
+		else
+		{
+			ops.push_back({ Step::EVALUATE, node });
+		}
+	}
+}
+
+DeepExpr::~DeepExpr()
+{
+	dismantle(std::move(expr));
+}
+
+DeepStmt::~DeepStmt()
+{
+	dismantle(std::move(stmt));
+}
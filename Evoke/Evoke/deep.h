@@ -0,0 +1,9 @@
+#pragma once
+#include <memory>
+#include "expr.h"
+#include "stmt.h"
+
+//	destroys a tree without recursing, each node's children are moved onto a
+//	worklist before the node itself is freed
+void dismantle(std::unique_ptr<Expr> expr);
+void dismantle(std::unique_ptr<Stmt> stmt);
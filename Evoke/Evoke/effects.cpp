@@ -0,0 +1,662 @@
+#include "effects.h"
+
+void Effects::addStmt(const Stmt& stmt)
+{
+	if (const PrintStmt* print = dynamic_cast<const PrintStmt*>(&stmt))
+	{
+		output = true;
+		addExpr(*print->expr);
+	}
+	else if (const ExpressionStmt* expression = dynamic_cast<const ExpressionStmt*>(&stmt))
+	{
+		addExpr(*expression->expr);
+	}
+	else if (const ByteStmt* byte = dynamic_cast<const ByteStmt*>(&stmt))
+	{
+		declares.insert(byte->name.lexeme);
+		if (byte->initializer != nullptr)
+			addExpr(*byte->initializer);
+	}
+	else if (const ArrayStmt* array = dynamic_cast<const ArrayStmt*>(&stmt))
+	{
+		for (const auto& element : array->elements)
+			addExpr(*element);
+		if (array->count != nullptr)
+			addExpr(*array->count);
+		if (array->slice)
+		{
+			if (array->first != nullptr)
+				addExpr(*array->first);
+			if (array->last != nullptr)
+				addExpr(*array->last);
+			arrayReads.insert(array->source.lexeme);
+		}
+		arrayDeclares.insert(array->name.lexeme);
+	}
+	//	maps go into the array sets, a map and an array of one name only make
+	//	the analysis more careful
+	else if (const MapStmt* map = dynamic_cast<const MapStmt*>(&stmt))
+	{
+		arrayDeclares.insert(map->name.lexeme);
+	}
+	else if (const DeleteStmt* deleteStmt = dynamic_cast<const DeleteStmt*>(&stmt))
+	{
+		addExpr(*deleteStmt->key);
+		arrayWrites.insert(deleteStmt->name.lexeme);
+	}
+	else if (const BlockStmt* block = dynamic_cast<const BlockStmt*>(&stmt))
+	{
+		for (const auto& statement : block->stmts)
+		{
+			if (statement != nullptr)
+				addStmt(*statement);
+		}
+	}
+	else if (const IfStmt* ifStmt = dynamic_cast<const IfStmt*>(&stmt))
+	{
+		addExpr(*ifStmt->condition);
+		addStmt(*ifStmt->thenBranch);
+		if (ifStmt->elseBranch != nullptr)
+			addStmt(*ifStmt->elseBranch);
+	}
+	else if (const WhileStmt* whileStmt = dynamic_cast<const WhileStmt*>(&stmt))
+	{
+		addExpr(*whileStmt->condition);
+		addStmt(*whileStmt->body);
+	}
+	else if (const ParallelStmt* parallel = dynamic_cast<const ParallelStmt*>(&stmt))
+	{
+		addExpr(*parallel->from);
+		addExpr(*parallel->to);
+		declares.insert(parallel->index.lexeme);
+		for (const auto& reduction : parallel->reductions)
+		{
+			reads.insert(reduction.name.lexeme);
+			writes.insert(reduction.name.lexeme);
+		}
+		addStmt(*parallel->body);
+	}
+	else if (const EvokeStmt* evoke = dynamic_cast<const EvokeStmt*>(&stmt))
+	{
+		//	a post only queues the event, a '??' guard is checked when it runs
+		if (!evoke->deferred)
+			opaque = true;
+		else if (!evoke->repeat && evoke->condition != nullptr)
+			addExpr(*evoke->condition);
+	}
+	else
+	{
+		opaque = true;
+	}
+}
+
+void Effects::addExpr(const Expr& expr)
+{
+	if (const UnaryExpr* unary = dynamic_cast<const UnaryExpr*>(&expr))
+	{
+		addExpr(*unary->operand);
+	}
+	else if (const BinaryExpr* binary = dynamic_cast<const BinaryExpr*>(&expr))
+	{
+		addExpr(*binary->left);
+		addExpr(*binary->right);
+	}
+	else if (const GroupingExpr* grouping = dynamic_cast<const GroupingExpr*>(&expr))
+	{
+		addExpr(*grouping->expr);
+	}
+	else if (dynamic_cast<const LiteralExpr*>(&expr))
+	{
+	}
+	else if (const VariableExpr* variable = dynamic_cast<const VariableExpr*>(&expr))
+	{
+		reads.insert(variable->name.lexeme);
+	}
+	else if (const AssignmentExpr* assignment = dynamic_cast<const AssignmentExpr*>(&expr))
+	{
+		writes.insert(assignment->name.lexeme);
+		addExpr(*assignment->value);
+	}
+	else if (const ArrayPushExpr* push = dynamic_cast<const ArrayPushExpr*>(&expr))
+	{
+		arrayWrites.insert(push->name.lexeme);
+		addExpr(*push->value);
+	}
+	else if (const ArrayAccessExpr* access = dynamic_cast<const ArrayAccessExpr*>(&expr))
+	{
+		arrayReads.insert(access->name.lexeme);
+		addExpr(*access->index);
+	}
+	else if (const ArraySetExpr* set = dynamic_cast<const ArraySetExpr*>(&expr))
+	{
+		arrayWrites.insert(set->name.lexeme);
+		addExpr(*set->index);
+		addExpr(*set->value);
+	}
+	else if (const MapAccessExpr* access = dynamic_cast<const MapAccessExpr*>(&expr))
+	{
+		arrayReads.insert(access->name.lexeme);
+		addExpr(*access->key);
+	}
+	else if (const MapSetExpr* set = dynamic_cast<const MapSetExpr*>(&expr))
+	{
+		arrayWrites.insert(set->name.lexeme);
+		addExpr(*set->key);
+		addExpr(*set->value);
+	}
+	else if (const MapContainsExpr* contains = dynamic_cast<const MapContainsExpr*>(&expr))
+	{
+		arrayReads.insert(contains->name.lexeme);
+		addExpr(*contains->key);
+	}
+	else if (const CallExpr* call = dynamic_cast<const CallExpr*>(&expr))
+	{
+		for (const auto& argument : call->arguments)
+			addExpr(*argument);
+		const BuiltinInfo& info = builtinInfo(call->builtin);
+		for (const auto& array : call->arrays)
+			arrayReads.insert(array.lexeme);
+		if (info.writes)
+			arrayWrites.insert(call->arrays[0].lexeme);
+		//	like a redeclaration, the length checked at a loop's entry is gone
+		if (info.resizes)
+			arrayDeclares.insert(call->arrays[0].lexeme);
+		//	files are ordered with each other like the standard streams
+		if (info.files)
+		{
+			input = input || info.writes;
+			output = output || !info.writes;
+		}
+	}
+	else if (dynamic_cast<const InputExpr*>(&expr))
+	{
+		input = true;
+	}
+	else if (const IncrementExpr* increment = dynamic_cast<const IncrementExpr*>(&expr))
+	{
+		reads.insert(increment->name.lexeme);
+		writes.insert(increment->name.lexeme);
+	}
+	else if (const CompareLocalExpr* compare = dynamic_cast<const CompareLocalExpr*>(&expr))
+	{
+		reads.insert(compare->name.lexeme);
+	}
+	else if (const CompareAdjacentExpr* compare = dynamic_cast<const CompareAdjacentExpr*>(&expr))
+	{
+		reads.insert(compare->index.lexeme);
+		arrayReads.insert(compare->name.lexeme);
+	}
+	else if (const TempExpr* temp = dynamic_cast<const TempExpr*>(&expr))
+	{
+		addExpr(*temp->original);
+	}
+	else if (const CaptureExpr* capture = dynamic_cast<const CaptureExpr*>(&expr))
+	{
+		addExpr(*capture->expr);
+	}
+	else
+	{
+		opaque = true;
+	}
+}
+
+void Effects::add(const Effects& other)
+{
+	reads.insert(other.reads.begin(), other.reads.end());
+	writes.insert(other.writes.begin(), other.writes.end());
+	declares.insert(other.declares.begin(), other.declares.end());
+	arrayReads.insert(other.arrayReads.begin(), other.arrayReads.end());
+	arrayWrites.insert(other.arrayWrites.begin(), other.arrayWrites.end());
+	arrayDeclares.insert(other.arrayDeclares.begin(), other.arrayDeclares.end());
+	input = input || other.input;
+	output = output || other.output;
+	opaque = opaque || other.opaque;
+}
+
+void Effects::widen(const std::set<std::string>& views)
+{
+	for (auto* names : { &arrayReads, &arrayWrites, &arrayDeclares })
+	{
+		for (const auto& name : *names)
+		{
+			if (views.count(name))
+			{
+				names->insert(views.begin(), views.end());
+				break;
+			}
+		}
+	}
+}
+
+bool Effects::mayChange(const std::string& name) const
+{
+	return opaque || writes.count(name) || declares.count(name);
+}
+
+bool Effects::mayChangeArray(const std::string& name) const
+{
+	return opaque || arrayWrites.count(name) || arrayDeclares.count(name);
+}
+
+bool Effects::conflicts(const Effects& other) const
+{
+	if (opaque || other.opaque)
+		return true;
+	//	input and output are ordered streams
+	if ((input || output) && (other.input || other.output))
+		return true;
+
+	auto touches = [](const Effects& effects, const std::string& name)
+	{
+		return effects.reads.count(name) || effects.writes.count(name) || effects.declares.count(name);
+	};
+	auto touchesArray = [](const Effects& effects, const std::string& name)
+	{
+		return effects.arrayReads.count(name) || effects.arrayWrites.count(name) || effects.arrayDeclares.count(name);
+	};
+
+	for (const Effects* first : { this, &other })
+	{
+		const Effects& second = first == this ? other : *this;
+		for (const auto& name : first->writes)
+			if (touches(second, name)) return true;
+		for (const auto& name : first->declares)
+			if (touches(second, name)) return true;
+		for (const auto& name : first->arrayWrites)
+			if (touchesArray(second, name)) return true;
+		for (const auto& name : first->arrayDeclares)
+			if (touchesArray(second, name)) return true;
+	}
+	return false;
+}
+
+IterationCheck::IterationCheck(const Token& index, const std::vector<ParallelStmt::Reduction>& reductions)
+	: loop(index), index(index.lexeme)
+{
+	for (const auto& reduction : reductions)
+		this->reductions[reduction.name.lexeme] = reduction.op.lexeme;
+}
+
+bool IterationCheck::check(const Stmt& body)
+{
+	//	the first pass finds the shared arrays that are written, the second
+	//	checks every access to them
+	for (bool pass : { true, false })
+	{
+		collecting = pass;
+		sharedViews.clear();
+		scopes.assign(1, std::set<std::string>());
+		arrayScopes.assign(1, std::set<std::string>());
+		checkStmt(body);
+		if (failed)
+			return false;
+	}
+	return true;
+}
+
+void IterationCheck::fail(const Token& at, const std::string& why)
+{
+	if (failed || collecting)
+		return;
+	failed = true;
+	token = at;
+	message = why;
+}
+
+bool IterationCheck::isLocal(const std::string& name, bool array) const
+{
+	for (const auto& scope : array ? arrayScopes : scopes)
+	{
+		if (scope.count(name))
+			return true;
+	}
+	return false;
+}
+
+bool IterationCheck::atIndex(const Expr& expr) const
+{
+	const VariableExpr* variable = dynamic_cast<const VariableExpr*>(&expr);
+	return variable != nullptr && variable->name.lexeme == index && !isLocal(index, false);
+}
+
+void IterationCheck::write(const Token& name)
+{
+	if (name.lexeme == index && !isLocal(name.lexeme, false))
+		fail(name, "A parallel loop can't assign its index.");
+	else if (!isLocal(name.lexeme, false) && !reductions.count(name.lexeme))
+		fail(name, "Iterations of a parallel loop can't write shared variable '" + name.lexeme + "', make it a reduction.");
+}
+
+bool IterationCheck::isReduction(const std::string& name) const
+{
+	return reductions.count(name) && !isLocal(name, false);
+}
+
+std::string IterationCheck::reductionForm(const std::string& name) const
+{
+	const std::string& op = reductions.at(name);
+	if (op == "min" || op == "max")
+		return "if (x " + std::string(op == "min" ? "<" : ">") + " " + name + ") " + name + " = x";
+	return name + " = " + name + " " + op + " ...";
+}
+
+static const Expr& ungroup(const Expr& expr)
+{
+	const GroupingExpr* grouping = dynamic_cast<const GroupingExpr*>(&expr);
+	return grouping != nullptr ? ungroup(*grouping->expr) : expr;
+}
+
+static bool isVariable(const Expr& expr, const std::string& name)
+{
+	const VariableExpr* variable = dynamic_cast<const VariableExpr*>(&ungroup(expr));
+	return variable != nullptr && variable->name.lexeme == name;
+}
+
+//	the same expression written twice, as far as the shapes below go
+static bool sameExpr(const Expr& a, const Expr& b)
+{
+	const Expr& left = ungroup(a);
+	const Expr& right = ungroup(b);
+	if (const VariableExpr* variable = dynamic_cast<const VariableExpr*>(&left))
+		return isVariable(right, variable->name.lexeme);
+	if (const LiteralExpr* literal = dynamic_cast<const LiteralExpr*>(&left))
+	{
+		const LiteralExpr* other = dynamic_cast<const LiteralExpr*>(&right);
+		return other != nullptr && other->literal.lexeme == literal->literal.lexeme;
+	}
+	if (const UnaryExpr* unary = dynamic_cast<const UnaryExpr*>(&left))
+	{
+		const UnaryExpr* other = dynamic_cast<const UnaryExpr*>(&right);
+		return other != nullptr && other->op.type == unary->op.type && sameExpr(*unary->operand, *other->operand);
+	}
+	if (const BinaryExpr* binary = dynamic_cast<const BinaryExpr*>(&left))
+	{
+		const BinaryExpr* other = dynamic_cast<const BinaryExpr*>(&right);
+		return other != nullptr && other->op.type == binary->op.type
+			&& sameExpr(*binary->left, *other->left) && sameExpr(*binary->right, *other->right);
+	}
+	if (const ArrayAccessExpr* access = dynamic_cast<const ArrayAccessExpr*>(&left))
+	{
+		const ArrayAccessExpr* other = dynamic_cast<const ArrayAccessExpr*>(&right);
+		return other != nullptr && other->name.lexeme == access->name.lexeme && sameExpr(*access->index, *other->index);
+	}
+	return false;
+}
+
+//	name = name op a op b ..., the operands checked as usual, where they
+//	can't read the reduction
+bool IterationCheck::reductionUpdate(const AssignmentExpr& assignment)
+{
+	const std::string& op = reductions.at(assignment.name.lexeme);
+	std::vector<const Expr*> operands;
+	const Expr* left = assignment.value.get();
+	const BinaryExpr* binary = dynamic_cast<const BinaryExpr*>(left);
+	while (binary != nullptr && binary->op.lexeme == op)
+	{
+		operands.push_back(binary->right.get());
+		left = binary->left.get();
+		binary = dynamic_cast<const BinaryExpr*>(left);
+	}
+	if (operands.empty() || !isVariable(*left, assignment.name.lexeme))
+		return false;
+	for (const Expr* operand : operands)
+		checkExpr(*operand);
+	return true;
+}
+
+//	if (x < name) name = x for min, the comparison either way round and
+//	maybe with '<=', the then branch maybe in a block of its own
+bool IterationCheck::extremeUpdate(const IfStmt& stmt)
+{
+	if (stmt.elseBranch != nullptr)
+		return false;
+	const Stmt* then = stmt.thenBranch.get();
+	const BlockStmt* block = dynamic_cast<const BlockStmt*>(then);
+	if (block != nullptr && block->stmts.size() == 1)
+		then = block->stmts[0].get();
+	const ExpressionStmt* expression = dynamic_cast<const ExpressionStmt*>(then);
+	const AssignmentExpr* assignment = expression != nullptr ? dynamic_cast<const AssignmentExpr*>(expression->expr.get()) : nullptr;
+	const BinaryExpr* condition = dynamic_cast<const BinaryExpr*>(&ungroup(*stmt.condition));
+	if (assignment == nullptr || condition == nullptr || !isReduction(assignment->name.lexeme))
+		return false;
+
+	const std::string& name = assignment->name.lexeme;
+	const std::string& op = reductions.at(name);
+	TokenType compare = condition->op.type;
+	bool less = compare == LESS || compare == LESS_EQUAL;
+	bool greater = compare == GREATER || compare == GREATER_EQUAL;
+	//	whether the condition holds when x is below the reduction
+	const Expr* value;
+	bool below;
+	if (isVariable(*condition->right, name))
+	{
+		value = condition->left.get();
+		below = less;
+	}
+	else if (isVariable(*condition->left, name))
+	{
+		value = condition->right.get();
+		below = greater;
+	}
+	else
+		return false;
+	if (!(less || greater) || below != (op == "min") || (op != "min" && op != "max") || !sameExpr(*value, *assignment->value))
+		return false;
+	checkExpr(*value);
+	return true;
+}
+
+void IterationCheck::checkStmt(const Stmt& stmt)
+{
+	if (const PrintStmt* print = dynamic_cast<const PrintStmt*>(&stmt))
+	{
+		checkExpr(*print->expr);
+	}
+	else if (const ExpressionStmt* expression = dynamic_cast<const ExpressionStmt*>(&stmt))
+	{
+		checkExpr(*expression->expr);
+	}
+	else if (const ByteStmt* byte = dynamic_cast<const ByteStmt*>(&stmt))
+	{
+		if (byte->initializer != nullptr)
+			checkExpr(*byte->initializer);
+		scopes.back().insert(byte->name.lexeme);
+	}
+	else if (const ArrayStmt* array = dynamic_cast<const ArrayStmt*>(&stmt))
+	{
+		for (const auto& element : array->elements)
+			checkExpr(*element);
+		if (array->count != nullptr)
+			checkExpr(*array->count);
+		if (array->slice)
+		{
+			if (array->first != nullptr)
+				checkExpr(*array->first);
+			if (array->last != nullptr)
+				checkExpr(*array->last);
+			//	a view of a shared array can be read, writing it would write
+			//	the shared elements anywhere
+			const std::string& source = array->source.lexeme;
+			if (!isLocal(source, true) || sharedViews.count(source))
+			{
+				if (!collecting && writtenArrays.count(source))
+					fail(array->source, "Array '" + source + "' is written by the loop, iterations can only read it at the loop index.");
+				sharedViews.insert(array->name.lexeme);
+			}
+		}
+		arrayScopes.back().insert(array->name.lexeme);
+	}
+	else if (const MapStmt* map = dynamic_cast<const MapStmt*>(&stmt))
+	{
+		arrayScopes.back().insert(map->name.lexeme);
+	}
+	else if (const DeleteStmt* deleteStmt = dynamic_cast<const DeleteStmt*>(&stmt))
+	{
+		checkExpr(*deleteStmt->key);
+		if (!isLocal(deleteStmt->name.lexeme, true))
+			fail(deleteStmt->name, "Iterations of a parallel loop can't change shared map '" + deleteStmt->name.lexeme + "'.");
+	}
+	else if (const BlockStmt* block = dynamic_cast<const BlockStmt*>(&stmt))
+	{
+		scopes.emplace_back();
+		arrayScopes.emplace_back();
+		for (const auto& statement : block->stmts)
+		{
+			if (statement != nullptr)
+				checkStmt(*statement);
+		}
+		scopes.pop_back();
+		arrayScopes.pop_back();
+	}
+	else if (const IfStmt* ifStmt = dynamic_cast<const IfStmt*>(&stmt))
+	{
+		if (extremeUpdate(*ifStmt))
+			return;
+		checkExpr(*ifStmt->condition);
+		checkStmt(*ifStmt->thenBranch);
+		if (ifStmt->elseBranch != nullptr)
+			checkStmt(*ifStmt->elseBranch);
+	}
+	else if (const WhileStmt* whileStmt = dynamic_cast<const WhileStmt*>(&stmt))
+	{
+		checkExpr(*whileStmt->condition);
+		checkStmt(*whileStmt->body);
+	}
+	else if (const ParallelStmt* parallel = dynamic_cast<const ParallelStmt*>(&stmt))
+	{
+		//	an inner loop runs in order inside the iteration, its index is one
+		//	more local and its reductions are writes
+		checkExpr(*parallel->from);
+		checkExpr(*parallel->to);
+		for (const auto& reduction : parallel->reductions)
+		{
+			//	an inner reduction of the same kind folds into this one
+			if (!isReduction(reduction.name.lexeme))
+				write(reduction.name);
+			else if (reductions.at(reduction.name.lexeme) != reduction.op.lexeme)
+				fail(reduction.name, "Reduction '" + reduction.name.lexeme + "' can only be updated as '" + reductionForm(reduction.name.lexeme) + "' inside the loop.");
+		}
+		scopes.emplace_back();
+		arrayScopes.emplace_back();
+		scopes.back().insert(parallel->index.lexeme);
+		checkStmt(*parallel->body);
+		scopes.pop_back();
+		arrayScopes.pop_back();
+	}
+	else if (const EvokeStmt* evoke = dynamic_cast<const EvokeStmt*>(&stmt))
+	{
+		fail(evoke->name, "Iterations of a parallel loop can't evoke events.");
+	}
+	else
+	{
+		fail(loop, "Iterations of a parallel loop are nested too deep to check.");
+	}
+}
+
+void IterationCheck::checkExpr(const Expr& expr)
+{
+	if (const UnaryExpr* unary = dynamic_cast<const UnaryExpr*>(&expr))
+	{
+		checkExpr(*unary->operand);
+	}
+	else if (const BinaryExpr* binary = dynamic_cast<const BinaryExpr*>(&expr))
+	{
+		checkExpr(*binary->left);
+		checkExpr(*binary->right);
+	}
+	else if (const GroupingExpr* grouping = dynamic_cast<const GroupingExpr*>(&expr))
+	{
+		checkExpr(*grouping->expr);
+	}
+	else if (dynamic_cast<const LiteralExpr*>(&expr))
+	{
+	}
+	else if (const VariableExpr* variable = dynamic_cast<const VariableExpr*>(&expr))
+	{
+		//	a chunk only sees its own partial
+		if (isReduction(variable->name.lexeme))
+			fail(variable->name, "Reduction '" + variable->name.lexeme + "' can only be updated as '" + reductionForm(variable->name.lexeme) + "' inside the loop.");
+	}
+	else if (const AssignmentExpr* assignment = dynamic_cast<const AssignmentExpr*>(&expr))
+	{
+		if (isReduction(assignment->name.lexeme))
+		{
+			if (!reductionUpdate(*assignment))
+				fail(assignment->name, "Reduction '" + assignment->name.lexeme + "' can only be updated as '" + reductionForm(assignment->name.lexeme) + "' inside the loop.");
+			return;
+		}
+		checkExpr(*assignment->value);
+		write(assignment->name);
+	}
+	else if (const ArrayPushExpr* push = dynamic_cast<const ArrayPushExpr*>(&expr))
+	{
+		//	a view pushed onto copies its elements out first, so a local one is fine
+		checkExpr(*push->value);
+		if (!isLocal(push->name.lexeme, true))
+			fail(push->name, "Iterations of a parallel loop can't push onto shared array '" + push->name.lexeme + "'.");
+	}
+	else if (const ArrayAccessExpr* access = dynamic_cast<const ArrayAccessExpr*>(&expr))
+	{
+		checkExpr(*access->index);
+		if (writtenArrays.count(access->name.lexeme) && !isLocal(access->name.lexeme, true) && !atIndex(*access->index))
+			fail(access->name, "Array '" + access->name.lexeme + "' is written by the loop, iterations can only read it at the loop index.");
+	}
+	else if (const ArraySetExpr* set = dynamic_cast<const ArraySetExpr*>(&expr))
+	{
+		checkExpr(*set->index);
+		checkExpr(*set->value);
+		if (!isLocal(set->name.lexeme, true))
+		{
+			if (collecting)
+				writtenArrays.insert(set->name.lexeme);
+			else if (!atIndex(*set->index))
+				fail(set->name, "Iterations of a parallel loop can only write shared array '" + set->name.lexeme + "' at the loop index.");
+		}
+		else if (sharedViews.count(set->name.lexeme))
+			fail(set->name, "View '" + set->name.lexeme + "' shares the elements of a shared array, iterations can't write it.");
+	}
+	else if (const MapAccessExpr* access = dynamic_cast<const MapAccessExpr*>(&expr))
+	{
+		checkExpr(*access->key);
+	}
+	else if (const MapContainsExpr* contains = dynamic_cast<const MapContainsExpr*>(&expr))
+	{
+		checkExpr(*contains->key);
+	}
+	else if (const MapSetExpr* set = dynamic_cast<const MapSetExpr*>(&expr))
+	{
+		checkExpr(*set->key);
+		checkExpr(*set->value);
+		if (!isLocal(set->name.lexeme, true))
+			fail(set->name, "Iterations of a parallel loop can't change shared map '" + set->name.lexeme + "'.");
+	}
+	else if (const CallExpr* call = dynamic_cast<const CallExpr*>(&expr))
+	{
+		//	the functions work on whole arrays, which other iterations may be
+		//	writing at their own index
+		for (const auto& argument : call->arguments)
+			checkExpr(*argument);
+		if (builtinInfo(call->builtin).files)
+			fail(call->name, "Iterations of a parallel loop can't load or save files.");
+		for (size_t i = 0; i < call->arrays.size(); i++)
+		{
+			const Token& array = call->arrays[i];
+			if (i == 0 && builtinInfo(call->builtin).writes && sharedViews.count(array.lexeme))
+				fail(array, "View '" + array.lexeme + "' shares the elements of a shared array, iterations can't write it.");
+			if (isLocal(array.lexeme, true))
+				continue;
+			if (i == 0 && builtinInfo(call->builtin).writes)
+				fail(array, "Iterations of a parallel loop can't change all of shared array '" + array.lexeme + "'.");
+			else if (!collecting && writtenArrays.count(array.lexeme) && call->builtin != Builtin::LEN)
+				fail(array, "Array '" + array.lexeme + "' is written by the loop, iterations can only read it at the loop index.");
+		}
+	}
+	else if (dynamic_cast<const InputExpr*>(&expr))
+	{
+		fail(loop, "Iterations of a parallel loop can't read input.");
+	}
+	else
+	{
+		fail(loop, "Iterations of a parallel loop are nested too deep to check.");
+	}
+}
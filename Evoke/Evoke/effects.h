@@ -0,0 +1,87 @@
+#pragma once
+#include <set>
+#include <map>
+#include <string>
+#include "expr.h"
+#include "stmt.h"
+
+//	summary of the names a piece of code touches
+//	used by the optimizer to decide what a rewrite is allowed to assume
+struct Effects
+{
+	std::set<std::string> reads;
+	std::set<std::string> writes;
+	std::set<std::string> declares;
+
+	std::set<std::string> arrayReads;
+	std::set<std::string> arrayWrites;
+	std::set<std::string> arrayDeclares;
+
+	bool input = false;
+	bool output = false;
+	//	contains a node the analysis doesn't understand, assume anything
+	bool opaque = false;
+
+	void addStmt(const Stmt& stmt);
+	void addExpr(const Expr& expr);
+
+	void add(const Effects& other);
+	//	a view shares its elements with the array it was taken from, so when
+	//	the program has views one of their names stands for all of them
+	void widen(const std::set<std::string>& views);
+
+	//	true if the code can change what the name evaluates to
+	bool mayChange(const std::string& name) const;
+	bool mayChangeArray(const std::string& name) const;
+
+	//	true if running this and other in either order can give different results
+	bool conflicts(const Effects& other) const;
+};
+
+//	decides whether the iterations of a parallel loop can run at once: they
+//	may only write names they declare themselves, the loop's reductions and
+//	shared arrays at the loop index, which is then the only index those arrays
+//	are read at. reading input, evoking, pushing onto shared arrays, changing
+//	shared maps and calling functions that change a shared array as a whole
+//	are out. every chunk runs on a partial of its own, so a reduction is only
+//	touched by 'name = name op expr' for + and *, and 'if (x < name) name = x'
+//	for min ('>' for max)
+class IterationCheck
+{
+public:
+	IterationCheck(const Token& index, const std::vector<ParallelStmt::Reduction>& reductions);
+	//	false if the body was rejected, token and message say why
+	bool check(const Stmt& body);
+	//	shared arrays the iterations write at the loop index
+	const std::set<std::string>& sharedWrites() const { return writtenArrays; }
+
+	Token token;
+	std::string message;
+
+private:
+	void checkStmt(const Stmt& stmt);
+	void checkExpr(const Expr& expr);
+	void write(const Token& name);
+	bool isReduction(const std::string& name) const;
+	bool reductionUpdate(const AssignmentExpr& assignment);
+	bool extremeUpdate(const IfStmt& stmt);
+	std::string reductionForm(const std::string& name) const;
+	void fail(const Token& at, const std::string& why);
+	bool isLocal(const std::string& name, bool array) const;
+	bool atIndex(const Expr& expr) const;
+
+	//	errors without a token of their own point at the loop index
+	Token loop;
+	std::string index;
+	//	operator of each reduction by name, '+', '*', 'min' or 'max'
+	std::map<std::string, std::string> reductions;
+	//	names declared by the body so far, one set per open scope
+	std::vector<std::set<std::string>> scopes;
+	std::vector<std::set<std::string>> arrayScopes;
+	//	shared arrays the body writes, found by a first pass
+	std::set<std::string> writtenArrays;
+	//	views the body declares of shared arrays, by name
+	std::set<std::string> sharedViews;
+	bool collecting = false;
+	bool failed = false;
+};
@@ -1,103 +1,161 @@
 #include "environment.h"
 
+//	lookups walk the enclosing chain in a loop, a deeply nested block would
+//	otherwise recurse once per scope
+
+//	redefining only assigns, so definitions of names reserved beforehand
+//	never change the map itself
 void Environment::defineVariable(const std::string& name, Value value)
 {
-	values[name] = value;
+	if (versions != nullptr)
+		versions->bump(name);
+
+	auto it = values.find(name);
+	if (it != values.end())
+		it->second = std::move(value);
+	else
+		values.emplace(name, std::move(value));
+}
+
+void Environment::nest(std::unique_ptr<Environment> outer)
+{
+	enclosing = std::move(outer);
+	versions = enclosing != nullptr ? enclosing->versions : nullptr;
+	if (versions != nullptr)
+		scope = versions->tick();
+}
+
+const Environment& Environment::definingScope() const
+{
+	const Environment* env = this;
+	while (env->values.empty() && env->arrayMap.empty() && env->maps.empty() && env->enclosing != nullptr)
+		env = env->enclosing.get();
+	return *env;
+}
+
+//	adds the name to this scope ahead of its definition, used before
+//	definitions run on several threads at once
+void Environment::reserveVariable(const std::string& name)
+{
+	if (values.find(name) == values.end())
+		values.emplace(name, Value());
+}
+
+void Environment::removeVariable(const std::string& name)
+{
+	values.erase(name);
 }
 
-void Environment::assignVariable(Token name, Value value)
+void Environment::assignVariable(const Token& name, Value value)
 {
-	if (values.find(name.lexeme) != values.end())
+	for (Environment* env = this; env != nullptr; env = env->enclosing.get())
 	{
-		values[name.lexeme] = value;
-		return;
+		auto it = env->values.find(name.lexeme);
+		if (it != env->values.end())
+		{
+			it->second = std::move(value);
+			if (versions != nullptr)
+				versions->bump(name.lexeme);
+			return;
+		}
 	}
 
-	if (enclosing != nullptr)
+	throw RuntimeError(name, "Undefined variable '" + name.lexeme + "'.");
+}
+
+const Value& Environment::getVariable(const Token& name) const
+{
+	for (const Environment* env = this; env != nullptr; env = env->enclosing.get())
 	{
-		enclosing->assignVariable(name, value);
-		return;
+		auto it = env->values.find(name.lexeme);
+		if (it != env->values.end())
+			return it->second;
 	}
 
 	throw RuntimeError(name, "Undefined variable '" + name.lexeme + "'.");
 }
 
-Value Environment::getVariable(Token name) const
+//	returns nullptr instead of throwing so callers can fall back to the checked path
+Value* Environment::findVariable(const std::string& name)
 {
-	if (values.find(name.lexeme) != values.end())
+	for (Environment* env = this; env != nullptr; env = env->enclosing.get())
 	{
-		return values.at(name.lexeme);
+		auto it = env->values.find(name);
+		if (it != env->values.end())
+			return &it->second;
 	}
 
-	if (enclosing.get() != nullptr)
-		return enclosing->getVariable(name);
-
-	throw RuntimeError(name, "Undefined variable '" + name.lexeme + "'.");
-	return double();
+	return nullptr;
 }
 
 void Environment::defineArray(const std::string& name)
 {
-	arrayMap[name] = std::vector<Value>();
+	arrayMap.insert_or_assign(name, Array());
 }
 
-void Environment::pushArray(Token name, Value value)
+void Environment::defineArray(const std::string& name, Array array)
 {
-	if (arrayMap.find(name.lexeme) != arrayMap.end())
-	{
-		arrayMap[name.lexeme].push_back(value);
-		return;
-	}
+	arrayMap.insert_or_assign(name, std::move(array));
+}
 
-	if (enclosing != nullptr)
-	{
-		enclosing->pushArray(name, value);
-		return;
-	}
+void Environment::pushArray(const Token& name, Value value)
+{
+	Array* array = findArray(name.lexeme);
+	if (array == nullptr)
+		throw RuntimeError(name, "Undefined array '" + name.lexeme + "'.");
 
-	throw RuntimeError(name, "Undefined array '" + name.lexeme + "'.");
+	array->push(value);
 }
 
-void Environment::setArrayElement(Token name, int index, Value value)
+void Environment::setArrayElement(const Token& name, int64_t index, Value value)
 {
-	if (arrayMap.find(name.lexeme) != arrayMap.end())
-	{
-		if (index >= 0 && index < arrayMap[name.lexeme].size())
-		{
-			arrayMap[name.lexeme][index] = value;
-			return;
-		}
-		else
-		{
-			throw RuntimeError(name, "Index out of bounds for array '" + name.lexeme + "'.");
-		}
-	}
+	Array* array = findArray(name.lexeme);
+	if (array == nullptr)
+		throw RuntimeError(name, "Undefined array '" + name.lexeme + "'.");
+
+	if (index < 0 || static_cast<uint64_t>(index) >= array->size())
+		throw RuntimeError(name, "Index out of bounds for array '" + name.lexeme + "'.");
+
+	array->set(index, value);
+}
+
+Value Environment::getArrayElement(const Token& name, int64_t index)
+{
+	Array* array = findArray(name.lexeme);
+	if (array == nullptr)
+		throw RuntimeError(name, "Undefined array '" + name.lexeme + "'.");
+
+	if (index < 0 || static_cast<uint64_t>(index) >= array->size())
+		throw RuntimeError(name, "Index out of bounds for array '" + name.lexeme + "'.");
+
+	return array->get(index);
+}
 
-	if (enclosing != nullptr)
+Array* Environment::findArray(const std::string& name)
+{
+	for (Environment* env = this; env != nullptr; env = env->enclosing.get())
 	{
-		enclosing->setArrayElement(name, index, value);
-		return;
+		auto it = env->arrayMap.find(name);
+		if (it != env->arrayMap.end())
+			return &it->second;
 	}
 
-	throw RuntimeError(name, "Undefined array '" + name.lexeme + "'.");
+	return nullptr;
 }
 
-Value Environment::getArrayElement(Token name, int index)
+void Environment::defineMap(const std::string& name)
 {
-	if (arrayMap.find(name.lexeme) != arrayMap.end())
+	maps[name] = Map();
+}
+
+Map& Environment::getMap(const Token& name)
+{
+	for (Environment* env = this; env != nullptr; env = env->enclosing.get())
 	{
-		if (index >= 0 && index < arrayMap[name.lexeme].size())
-		{
-			return arrayMap[name.lexeme][index];
-		}
-		else
-		{
-			throw RuntimeError(name, "Index out of bounds for array '" + name.lexeme + "'.");
-		}
+		auto it = env->maps.find(name.lexeme);
+		if (it != env->maps.end())
+			return it->second;
 	}
 
-	if (enclosing != nullptr)
-		return enclosing->getArrayElement(name, index);
-
-	throw RuntimeError(name, "Undefined array '" + name.lexeme + "'.");
+	throw RuntimeError(name, "Undefined map '" + name.lexeme + "'.");
 }
@@ -3,31 +3,71 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <cstdint>
 #include "types.h"
 #include "errors.h"
 #include "token.h"
 #include "stmt.h"
+#include "array.h"
+#include "map.h"
+
+//	write stamps for the reactive mode, every write of a name stamps it with
+//	the next tick of one clock, so "changed since" is a comparison of stamps
+class Versions
+{
+public:
+	//	the address stays valid for the life of the table
+	const unsigned long long* stamp(const std::string& name) { return &stamps[name]; }
+	void bump(const std::string& name) { stamps[name] = ++clock; }
+	unsigned long long tick() { return ++clock; }
+	unsigned long long now() const { return clock; }
+
+private:
+	std::unordered_map<std::string, unsigned long long> stamps;
+	unsigned long long clock = 0;
+};
 
 class Environment
 {
 private:
 	std::unordered_map<std::string, Value> values;
-	std::unordered_map<std::string, std::vector<Value>> arrayMap;
+	std::unordered_map<std::string, Array> arrayMap;
+	std::unordered_map<std::string, Map> maps;
 
 public:
 	mutable std::unique_ptr<Environment> enclosing;
+	//	set in reactive mode, writes through this scope are stamped there
+	Versions* versions = nullptr;
+	//	tick the scope was entered at, tells scopes apart even at one address
+	unsigned long long scope = 0;
 	Environment() : enclosing(nullptr) {}
 	Environment(std::unique_ptr<Environment> enclosing) : enclosing(std::move(enclosing)) {}
 
+	//	links the scope inside outer
+	void nest(std::unique_ptr<Environment> outer);
+	//	innermost scope that defines anything, the empty ones in front of it
+	//	resolve every name the way it does
+	const Environment& definingScope() const;
+
 	// Variable handling
 	void defineVariable(const std::string& name, Value value);
-	void assignVariable(Token name, Value value);
-	Value getVariable(Token name) const;
+	void reserveVariable(const std::string& name);
+	//	drops the name from this scope only
+	void removeVariable(const std::string& name);
+	void assignVariable(const Token& name, Value value);
+	const Value& getVariable(const Token& name) const;
+	Value* findVariable(const std::string& name);
 
 	//	Array handling
 	void defineArray(const std::string& name);
-	void pushArray(Token name, Value value);
-	void setArrayElement(Token name, int index, Value value);
-	Value getArrayElement(Token name, int index);
+	void defineArray(const std::string& name, Array array);
+	void pushArray(const Token& name, Value value);
+	void setArrayElement(const Token& name, int64_t index, Value value);
+	Value getArrayElement(const Token& name, int64_t index);
+	Array* findArray(const std::string& name);
+
+	//	Map handling
+	void defineMap(const std::string& name);
+	Map& getMap(const Token& name);
 };
 
@@ -0,0 +1,91 @@
+#include "eventqueue.h"
+#include <algorithm>
+
+EventQueue::EventQueue(size_t capacity) : entries(capacity)
+{
+}
+
+void EventQueue::reset(size_t eventCount)
+{
+	tail = 0;
+	lastPost.assign(eventCount, SIZE_MAX);
+	overflow.clear();
+}
+
+//	a guarded repeat isn't coalesced, running it twice can differ from once
+bool EventQueue::isPending(int event, size_t open) const
+{
+	size_t index = lastPost[event];
+	return index >= open && index < tail
+		&& entries[index].event == event && entries[index].repeat == nullptr;
+}
+
+void EventQueue::append(const PendingEvent& event)
+{
+	if (event.repeat == nullptr)
+		lastPost[event.event] = tail;
+	entries[tail++] = event;
+}
+
+bool EventQueue::push(const PendingEvent& event, size_t open)
+{
+	if (event.repeat == nullptr && isPending(event.event, open))
+		return true;
+	if (tail == entries.size())
+		return false;
+
+	append(event);
+	return true;
+}
+
+bool EventQueue::push(const PendingEvent* events, size_t count, size_t open)
+{
+	for (size_t i = 0; i < count; i++)
+	{
+		if (!push(events[i], open))
+			return false;
+	}
+	return true;
+}
+
+void EventQueue::beginShared()
+{
+	sharedTail.store(tail, std::memory_order_relaxed);
+}
+
+//	slots are reserved for the whole batch at once, what doesn't fit goes to
+//	the overflow list so endShared can tell which post was the first too many
+void EventQueue::pushShared(const PendingEvent* events, size_t count)
+{
+	size_t at = sharedTail.fetch_add(count, std::memory_order_relaxed);
+	size_t fits = at < entries.size() ? std::min(count, entries.size() - at) : 0;
+	std::copy(events, events + fits, entries.begin() + at);
+	if (fits < count)
+	{
+		std::lock_guard<std::mutex> lock(overflowMutex);
+		overflow.insert(overflow.end(), events + fits, events + count);
+	}
+}
+
+//	called once every producer is done, the pool join orders their writes
+//	before this
+long long EventQueue::endShared(size_t open)
+{
+	size_t end = std::min(sharedTail.load(std::memory_order_relaxed), entries.size());
+	std::vector<PendingEvent> posted(entries.begin() + tail, entries.begin() + end);
+	posted.insert(posted.end(), overflow.begin(), overflow.end());
+	overflow.clear();
+
+	std::stable_sort(posted.begin(), posted.end(),
+		[](const PendingEvent& left, const PendingEvent& right) { return left.order < right.order; });
+
+	for (const auto& event : posted)
+	{
+		if (event.repeat == nullptr && isPending(event.event, open))
+			continue;
+		if (tail == entries.size())
+			return event.order;
+		append(event);
+	}
+	return -1;
+}
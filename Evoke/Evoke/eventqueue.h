@@ -0,0 +1,66 @@
+#pragma once
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <cstddef>
+
+class EvokeStmt;
+
+//	a posted event waiting for the current event to finish
+struct PendingEvent
+{
+	int event;
+	//	position of the posting subscriber in a parallel run, restores the
+	//	sequential order when posts from several threads are merged
+	unsigned order;
+	//	'??' guard, checked when the event is taken off the queue
+	const EvokeStmt* repeat;
+};
+
+//	bounded queue of pending events
+//	every running event owns the entries posted since it started, from its
+//	open index to the tail, and takes them in one batch once it is done
+//	posting an event that is already waiting in the open part is a no-op
+//
+//	push is for a single thread and uses no atomics. while a parallel run is
+//	active producers use pushShared, which reserves slots with one atomic add
+//	and takes no lock until the queue is full, the posts that don't fit then
+//	go to an overflow list under a mutex. endShared merges the posts back
+//	into subscription order
+class EventQueue
+{
+public:
+	static const size_t defaultCapacity = 1 << 16;
+
+	explicit EventQueue(size_t capacity = defaultCapacity);
+
+	//	empties the queue for a program with this many events
+	void reset(size_t eventCount);
+
+	size_t size() const { return tail; }
+	const PendingEvent& operator[](size_t index) const { return entries[index]; }
+	void truncate(size_t size) { tail = size; }
+
+	//	false when the queue is full
+	bool push(const PendingEvent& event, size_t open);
+	bool push(const PendingEvent* events, size_t count, size_t open);
+
+	void beginShared();
+	void pushShared(const PendingEvent* events, size_t count);
+	//	returns the order of the first post that didn't fit, or -1
+	long long endShared(size_t open);
+
+private:
+	bool isPending(int event, size_t open) const;
+	void append(const PendingEvent& event);
+
+	std::vector<PendingEvent> entries;
+	//	entry each event was last posted at without a guard, for coalescing
+	std::vector<size_t> lastPost;
+	std::mutex overflowMutex;
+	std::vector<PendingEvent> overflow;
+
+	//	the consumer's tail and the producers' shared tail on their own lines
+	alignas(64) size_t tail = 0;
+	alignas(64) std::atomic<size_t> sharedTail{ 0 };
+};
@@ -0,0 +1,207 @@
+#include "events.h"
+#include "effects.h"
+
+//	counting sort of the top level subscriptions by event id, stable so each
+//	event keeps its subscribers in source order
+void EventTable::build(const std::vector<std::unique_ptr<Stmt>>& statements, size_t eventCount,
+	const std::set<std::string>& views, bool schedule)
+{
+	this->views = views;
+	sourceOffsets.assign(eventCount + 1, 0);
+	for (const auto& statement : statements)
+	{
+		if (const SubscribedStmt* subscribed = dynamic_cast<const SubscribedStmt*>(statement.get()))
+			sourceOffsets[subscribed->id + 1]++;
+	}
+	for (size_t i = 1; i < sourceOffsets.size(); i++)
+		sourceOffsets[i] += sourceOffsets[i - 1];
+
+	sources.assign(sourceOffsets.back(), nullptr);
+	inlined.assign(sourceOffsets.back(), false);
+	posts.assign(eventCount, false);
+	std::vector<size_t> next(sourceOffsets.begin(), sourceOffsets.end() - 1);
+	for (const auto& statement : statements)
+	{
+		const SubscribedStmt* subscribed = dynamic_cast<const SubscribedStmt*>(statement.get());
+		if (subscribed == nullptr)
+			continue;
+
+		sources[next[subscribed->id]++] = subscribed->stmt.get();
+		const EvokeStmt* evoke = dynamic_cast<const EvokeStmt*>(subscribed->stmt.get());
+		if (evoke != nullptr && evoke->deferred)
+			posts[subscribed->id] = true;
+	}
+
+	std::vector<std::vector<const Stmt*>> schedules(eventCount);
+	if (schedule)
+	{
+		flatten(schedules);
+	}
+	else
+	{
+		for (size_t event = 0; event < eventCount; event++)
+			schedules[event].assign(sources.begin() + sourceOffsets[event], sources.begin() + sourceOffsets[event + 1]);
+	}
+
+	offsets.assign(eventCount + 1, 0);
+	for (size_t event = 0; event < eventCount; event++)
+		offsets[event + 1] = offsets[event] + schedules[event].size();
+
+	subscribers.assign(offsets.back(), Subscriber{ nullptr, nullptr, false, false, 1 });
+	for (size_t event = 0; event < eventCount; event++)
+	{
+		for (size_t index = offsets[event]; index < offsets[event + 1]; index++)
+		{
+			Subscriber& subscriber = subscribers[index];
+			subscriber.stmt = schedules[event][index - offsets[event]];
+			subscriber.evoke = dynamic_cast<const EvokeStmt*>(subscriber.stmt);
+			if (subscriber.evoke != nullptr && subscriber.evoke->deferred)
+				subscriber.evoke = nullptr;
+			subscriber.tail = index + 1 == offsets[event + 1];
+			if (subscriber.evoke != nullptr && subscriber.evoke->condition != nullptr)
+			{
+				Effects effects;
+				effects.addExpr(*subscriber.evoke->condition);
+				subscriber.pure = !effects.opaque && !effects.input
+					&& effects.writes.empty() && effects.arrayWrites.empty();
+			}
+		}
+	}
+
+	for (size_t event = 0; event < eventCount; event++)
+		findIndependent(static_cast<int>(event));
+}
+
+//	an unguarded evoke runs the whole list of its event right where it stands,
+//	which is what inlining it does. an event that posts is left alone, its
+//	posts have to run when it ends and not when the event inlining it does
+bool EventTable::inlinable(const EvokeStmt& evoke) const
+{
+	return !evoke.deferred && evoke.condition == nullptr && !posts[evoke.id];
+}
+
+//	builds the schedule of every event. an inlinable evoke is replaced by the
+//	finished schedule of the event it evokes, which is built first on an
+//	explicit stack. an evoke of an event still being built is a cycle and
+//	stays an evoke, as does one that would grow the schedule past the limit
+void EventTable::flatten(std::vector<std::vector<const Stmt*>>& schedules)
+{
+	enum State : char { UNBUILT, BUILDING, BUILT };
+	struct Frame
+	{
+		int event;
+		size_t next;
+	};
+
+	std::vector<State> states(schedules.size(), UNBUILT);
+	std::vector<Frame> frames;
+	for (size_t root = 0; root < schedules.size(); root++)
+	{
+		if (states[root] != UNBUILT)
+			continue;
+		states[root] = BUILDING;
+		frames.push_back({ static_cast<int>(root), sourceOffsets[root] });
+
+		while (!frames.empty())
+		{
+			Frame& top = frames.back();
+			if (top.next == sourceOffsets[top.event + 1])
+			{
+				states[top.event] = BUILT;
+				frames.pop_back();
+				continue;
+			}
+
+			std::vector<const Stmt*>& schedule = schedules[top.event];
+			const EvokeStmt* evoke = dynamic_cast<const EvokeStmt*>(sources[top.next]);
+			if (evoke != nullptr && inlinable(*evoke))
+			{
+				if (states[evoke->id] == UNBUILT)
+				{
+					//	comes back to this evoke once the other event is built
+					states[evoke->id] = BUILDING;
+					frames.push_back({ evoke->id, sourceOffsets[evoke->id] });
+					continue;
+				}
+
+				const std::vector<const Stmt*>& other = schedules[evoke->id];
+				if (states[evoke->id] == BUILT && schedule.size() + other.size() <= maxScheduled)
+				{
+					schedule.insert(schedule.end(), other.begin(), other.end());
+					inlined[top.next++] = true;
+					continue;
+				}
+			}
+			schedule.push_back(sources[top.next++]);
+		}
+	}
+}
+
+//	one node per event with its subscriber count, so wide fan-out stands out
+//	bold edges were inlined by the schedule, plain ones stay evokes, dashed
+//	ones are guarded and dotted ones are posts
+void EventTable::writeDot(std::ostream& out, const std::vector<std::string>& names) const
+{
+	out << "digraph events {\n";
+	for (size_t event = 0; event + 1 < sourceOffsets.size(); event++)
+	{
+		size_t count = sourceOffsets[event + 1] - sourceOffsets[event];
+		out << "\t\"" << names[event] << "\" [label=\"" << names[event] << "\\n" << count
+			<< (count == 1 ? " subscriber" : " subscribers") << "\"];\n";
+
+		for (size_t index = sourceOffsets[event]; index < sourceOffsets[event + 1]; index++)
+		{
+			const EvokeStmt* evoke = dynamic_cast<const EvokeStmt*>(sources[index]);
+			if (evoke == nullptr)
+				continue;
+
+			out << "\t\"" << names[event] << "\" -> \"" << names[evoke->id] << "\"";
+			if (evoke->deferred)
+				out << " [style=dotted, label=\"post" << (evoke->repeat ? " ??" : evoke->condition != nullptr ? " ?" : "") << "\"]";
+			else if (evoke->condition != nullptr)
+				out << " [style=dashed, label=\"" << (evoke->repeat ? "??" : "?") << "\"]";
+			else if (inlined[index])
+				out << " [style=bold]";
+			out << ";\n";
+		}
+	}
+	out << "}\n";
+}
+
+//	splits the subscriber list into runs that don't conflict with each other
+//	a subscriber that declares a name it also reads sees the outer name
+//	until its own definition, so it can't share a run with that definition
+//	made up front
+void EventTable::findIndependent(int event)
+{
+	size_t first = offsets[event];
+	size_t last = offsets[event + 1];
+	while (first < last)
+	{
+		Effects run;
+		size_t end = first;
+		while (end < last)
+		{
+			Effects effects;
+			effects.addStmt(*subscribers[end].stmt);
+			effects.widen(views);
+			bool alone = effects.opaque || effects.input || effects.output || !effects.arrayDeclares.empty();
+			for (const auto& name : effects.declares)
+				alone = alone || effects.reads.count(name) > 0;
+			//	the writes of a subscriber after one that fails are undone, which
+			//	is only cheap for variables
+			if (alone || (end > first && (run.conflicts(effects) || !effects.arrayWrites.empty())))
+				break;
+			run.add(effects);
+			std::vector<std::string>& writes = subscribers[end].writes;
+			writes.assign(effects.writes.begin(), effects.writes.end());
+			writes.insert(writes.end(), effects.declares.begin(), effects.declares.end());
+			end++;
+		}
+
+		if (end == first)
+			end = first + 1;
+		subscribers[first].independent = end - first;
+		first = end;
+	}
+}
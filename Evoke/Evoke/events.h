@@ -0,0 +1,69 @@
+#pragma once
+#include <vector>
+#include <memory>
+#include <string>
+#include <set>
+#include <ostream>
+#include "stmt.h"
+
+//	subscribers of every event, built once before the program runs
+//	all lists share one flat array, offsets[id] .. offsets[id + 1] is the slice
+//	of event id in subscription order, so evoking is an index and a loop
+//
+//	when scheduling, an unguarded evoke in a list is replaced by the list of
+//	the event it evokes, so a chain of them becomes one straight slice and
+//	only the guarded ones are left for the dispatch loop
+class EventTable
+{
+public:
+	struct Subscriber
+	{
+		const Stmt* stmt;
+		//	set when the subscriber is itself an evoke, the dispatch loop runs
+		//	those without recursing
+		const EvokeStmt* evoke;
+		//	last subscriber of its event, nothing runs after it returns
+		bool tail;
+		//	the evoke's condition only reads, evaluating it again is unobservable
+		bool pure;
+		//	number of subscribers starting here that touch disjoint names and do
+		//	no input or output, they give the same result in any order. only
+		//	the first of them can write arrays or maps
+		size_t independent;
+		//	variables the subscriber writes or defines, a batch puts them back
+		//	when a subscriber before this one fails
+		std::vector<std::string> writes;
+	};
+
+	//	views as the parser reports them, their subscribers are only independent
+	//	of ones that touch none of the arrays sharing elements
+	void build(const std::vector<std::unique_ptr<Stmt>>& statements, size_t eventCount,
+		const std::set<std::string>& views, bool schedule = true);
+	//	the evoke graph as written, in graphviz format
+	void writeDot(std::ostream& out, const std::vector<std::string>& names) const;
+
+	const Subscriber& subscriber(int event, size_t index) const { return subscribers[offsets[event] + index]; }
+	size_t count(int event) const { return offsets[event + 1] - offsets[event]; }
+	size_t eventCount() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+	//	index of a subscriber across all events, for per subscriber side tables
+	size_t position(int event, size_t index) const { return offsets[event] + index; }
+	size_t size() const { return subscribers.size(); }
+
+private:
+	//	most statements inlining grows one event's slice to
+	static const size_t maxScheduled = 1024;
+
+	void flatten(std::vector<std::vector<const Stmt*>>& schedules);
+	bool inlinable(const EvokeStmt& evoke) const;
+	void findIndependent(int event);
+
+	std::vector<Subscriber> subscribers;
+	std::vector<size_t> offsets;
+	//	subscriptions in source order, and whether the evoke among them was
+	//	inlined into the slice of its event
+	std::vector<const Stmt*> sources;
+	std::vector<size_t> sourceOffsets;
+	std::vector<char> inlined;
+	std::vector<char> posts;
+	std::set<std::string> views;
+};
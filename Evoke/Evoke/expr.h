@@ -1,156 +1,365 @@
-#pragma once
-#include "token.h"
-#include <memory>
-
-class ExprVisitor {
-public:
-	virtual void visit(const class UnaryExpr& expr) const = 0;
-	virtual void visit(const class BinaryExpr& expr) const = 0;
-	virtual void visit(const class GroupingExpr& expr) const = 0;
-	virtual void visit(const class LiteralExpr& expr) const = 0;
-	virtual void visit(const class VariableExpr& expr) const = 0;
-	virtual void visit(const class AssignmentExpr& expr) const = 0;
-	virtual void visit(const class ArrayPushExpr& expr) const = 0;
-	virtual void visit(const class ArrayAccessExpr& expr) const = 0;
-	virtual void visit(const class ArraySetExpr& expr) const = 0;
-	virtual void visit(const class InputExpr& expr) const = 0;
-};
-
-class Expr
-{
-public:
-	virtual ~Expr() = default;
-	virtual void accept(const ExprVisitor& visitor) const = 0;
-};
-
-class UnaryExpr : public Expr
-{
-public:
-	Token op;
-	std::unique_ptr<Expr> operand;
-
-	UnaryExpr(Token op, std::unique_ptr<Expr> operand)
-		: op(op), operand(std::move(operand)) {}
-
-	void accept(const ExprVisitor& visitor) const override
-	{
-		visitor.visit(*this);
-	}
-};
-
-class BinaryExpr : public Expr
-{
-public:
-	std::unique_ptr<Expr> left;
-	Token op;
-	std::unique_ptr<Expr> right;
-
-	BinaryExpr(std::unique_ptr<Expr> left, Token op, std::unique_ptr<Expr> right)
-		: left(std::move(left)), op(op), right(std::move(right)) {}
-
-	void accept(const ExprVisitor& visitor) const override
-	{
-		visitor.visit(*this);
-	}
-};
-
-class GroupingExpr : public Expr
-{
-public:
-	std::unique_ptr<Expr> expr;
-
-	GroupingExpr(std::unique_ptr<Expr> expr) : expr(std::move(expr)) {}
-
-	void accept(const ExprVisitor& visitor) const override
-	{
-		visitor.visit(*this);
-	}
-};
-
-class LiteralExpr : public Expr
-{
-public:
-	Token literal;
-	explicit LiteralExpr(Token literal) : literal(literal) {}
-	void accept(const ExprVisitor& visitor) const override
-	{
-		visitor.visit(*this);
-	}
-};
-
-class VariableExpr : public Expr
-{
-public:
-	Token name;
-	explicit VariableExpr(Token name) : name(name) {}
-	void accept(const ExprVisitor& visitor) const override
-	{
-		visitor.visit(*this);
-	}
-};
-
-class AssignmentExpr : public Expr
-{
-public:
-	Token name;
-	std::unique_ptr<Expr> value;
-
-	AssignmentExpr(Token name, std::unique_ptr<Expr> value)
-		: name(name), value(std::move(value)) {}
-
-	void accept(const ExprVisitor& visitor) const override
-	{
-		visitor.visit(*this);
-	}
-};
-
-class ArrayPushExpr : public Expr {
-public:
-	Token name;
-	std::unique_ptr<Expr> value;
-	ArrayPushExpr(Token name, std::unique_ptr<Expr> value)
-		: name(name), value(std::move(value)) {}
-
-	void accept(const ExprVisitor& visitor) const override
-	{
-		visitor.visit(*this);
-	}
-};
-
-class ArrayAccessExpr : public Expr {
-public:
-	Token name;
-	std::unique_ptr<Expr> index;
-	ArrayAccessExpr(Token name, std::unique_ptr<Expr> index)
-		: name(name), index(std::move(index)) {}
-
-	void accept(const ExprVisitor& visitor) const override
-	{
-		visitor.visit(*this);
-	}
-};
-
-class ArraySetExpr : public Expr {
-public:
-	Token name;
-	std::unique_ptr<Expr> index;
-	std::unique_ptr<Expr> value;
-
-	ArraySetExpr(Token name, std::unique_ptr<Expr> index, std::unique_ptr<Expr> value)
-		: name(name), index(std::move(index)), value(std::move(value)) {}
-
-	void accept(const ExprVisitor& visitor) const override
-	{
-		visitor.visit(*this);
-	}
-};
-
-class InputExpr : public Expr {
-public:
-	InputExpr() {};
-
-	void accept(const ExprVisitor& visitor) const override
-	{
-		visitor.visit(*this);
-	}
-};
\ No newline at end of file
+#pragma once
+#include "token.h"
+#include "builtins.h"
+#include <memory>
+#include <vector>
+
+//	visitor that hands its result back to the caller, the interpreter moves
+//	values up the tree with it and the printer returns nothing
+class ValueVisitor {
+public:
+	virtual Value visit(const class UnaryExpr& expr) const = 0;
+	virtual Value visit(const class BinaryExpr& expr) const = 0;
+	virtual Value visit(const class GroupingExpr& expr) const = 0;
+	virtual Value visit(const class LiteralExpr& expr) const = 0;
+	virtual Value visit(const class VariableExpr& expr) const = 0;
+	virtual Value visit(const class AssignmentExpr& expr) const = 0;
+	virtual Value visit(const class ArrayPushExpr& expr) const = 0;
+	virtual Value visit(const class ArrayAccessExpr& expr) const = 0;
+	virtual Value visit(const class ArraySetExpr& expr) const = 0;
+	virtual Value visit(const class InputExpr& expr) const = 0;
+	virtual Value visit(const class IncrementExpr& expr) const = 0;
+	virtual Value visit(const class CompareLocalExpr& expr) const = 0;
+	virtual Value visit(const class CompareAdjacentExpr& expr) const = 0;
+	virtual Value visit(const class TempExpr& expr) const = 0;
+	virtual Value visit(const class CaptureExpr& expr) const = 0;
+	virtual Value visit(const class DeepExpr& expr) const = 0;
+	virtual Value visit(const class CallExpr& expr) const = 0;
+	virtual Value visit(const class MapAccessExpr& expr) const = 0;
+	virtual Value visit(const class MapSetExpr& expr) const = 0;
+	virtual Value visit(const class MapContainsExpr& expr) const = 0;
+};
+
+class Expr
+{
+public:
+	virtual ~Expr() = default;
+	virtual Value accept(const ValueVisitor& visitor) const = 0;
+};
+
+class UnaryExpr : public Expr
+{
+public:
+	Token op;
+	std::unique_ptr<Expr> operand;
+
+	UnaryExpr(Token op, std::unique_ptr<Expr> operand)
+		: op(op), operand(std::move(operand)) {}
+
+	Value accept(const ValueVisitor& visitor) const override
+	{
+		return visitor.visit(*this);
+	}
+};
+
+class BinaryExpr : public Expr
+{
+public:
+	std::unique_ptr<Expr> left;
+	Token op;
+	std::unique_ptr<Expr> right;
+
+	BinaryExpr(std::unique_ptr<Expr> left, Token op, std::unique_ptr<Expr> right)
+		: left(std::move(left)), op(op), right(std::move(right)) {}
+
+	Value accept(const ValueVisitor& visitor) const override
+	{
+		return visitor.visit(*this);
+	}
+};
+
+class GroupingExpr : public Expr
+{
+public:
+	std::unique_ptr<Expr> expr;
+
+	GroupingExpr(std::unique_ptr<Expr> expr) : expr(std::move(expr)) {}
+
+	Value accept(const ValueVisitor& visitor) const override
+	{
+		return visitor.visit(*this);
+	}
+};
+
+class LiteralExpr : public Expr
+{
+public:
+	Token literal;
+	explicit LiteralExpr(Token literal) : literal(literal) {}
+	Value accept(const ValueVisitor& visitor) const override
+	{
+		return visitor.visit(*this);
+	}
+};
+
+class VariableExpr : public Expr
+{
+public:
+	Token name;
+	explicit VariableExpr(Token name) : name(name) {}
+	Value accept(const ValueVisitor& visitor) const override
+	{
+		return visitor.visit(*this);
+	}
+};
+
+class AssignmentExpr : public Expr
+{
+public:
+	Token name;
+	std::unique_ptr<Expr> value;
+
+	AssignmentExpr(Token name, std::unique_ptr<Expr> value)
+		: name(name), value(std::move(value)) {}
+
+	Value accept(const ValueVisitor& visitor) const override
+	{
+		return visitor.visit(*this);
+	}
+};
+
+class ArrayPushExpr : public Expr {
+public:
+	Token name;
+	std::unique_ptr<Expr> value;
+	ArrayPushExpr(Token name, std::unique_ptr<Expr> value)
+		: name(name), value(std::move(value)) {}
+
+	Value accept(const ValueVisitor& visitor) const override
+	{
+		return visitor.visit(*this);
+	}
+};
+
+class ArrayAccessExpr : public Expr {
+public:
+	Token name;
+	std::unique_ptr<Expr> index;
+	//	set by the optimizer when the enclosing loop proves the index in range
+	int rangeSlot = -1;
+	ArrayAccessExpr(Token name, std::unique_ptr<Expr> index)
+		: name(name), index(std::move(index)) {}
+
+	Value accept(const ValueVisitor& visitor) const override
+	{
+		return visitor.visit(*this);
+	}
+};
+
+class ArraySetExpr : public Expr {
+public:
+	Token name;
+	std::unique_ptr<Expr> index;
+	std::unique_ptr<Expr> value;
+	int rangeSlot = -1;
+
+	ArraySetExpr(Token name, std::unique_ptr<Expr> index, std::unique_ptr<Expr> value)
+		: name(name), index(std::move(index)), value(std::move(value)) {}
+
+	Value accept(const ValueVisitor& visitor) const override
+	{
+		return visitor.visit(*this);
+	}
+};
+
+class MapAccessExpr : public Expr {
+public:
+	Token name;
+	std::unique_ptr<Expr> key;
+	MapAccessExpr(Token name, std::unique_ptr<Expr> key)
+		: name(name), key(std::move(key)) {}
+
+	Value accept(const ValueVisitor& visitor) const override
+	{
+		return visitor.visit(*this);
+	}
+};
+
+class MapSetExpr : public Expr {
+public:
+	Token name;
+	std::unique_ptr<Expr> key;
+	std::unique_ptr<Expr> value;
+	MapSetExpr(Token name, std::unique_ptr<Expr> key, std::unique_ptr<Expr> value)
+		: name(name), key(std::move(key)), value(std::move(value)) {}
+
+	Value accept(const ValueVisitor& visitor) const override
+	{
+		return visitor.visit(*this);
+	}
+};
+
+//	key in name
+class MapContainsExpr : public Expr {
+public:
+	Token name;
+	std::unique_ptr<Expr> key;
+	MapContainsExpr(Token name, std::unique_ptr<Expr> key)
+		: name(name), key(std::move(key)) {}
+
+	Value accept(const ValueVisitor& visitor) const override
+	{
+		return visitor.visit(*this);
+	}
+};
+
+//	a built-in function, the arrays are named directly and the arguments are
+//	the rest
+class CallExpr : public Expr {
+public:
+	Token name;
+	Builtin builtin;
+	std::vector<Token> arrays;
+	std::vector<std::unique_ptr<Expr>> arguments;
+	CallExpr(Token name, Builtin builtin, std::vector<Token> arrays)
+		: name(name), builtin(builtin), arrays(std::move(arrays)) {}
+
+	Value accept(const ValueVisitor& visitor) const override
+	{
+		return visitor.visit(*this);
+	}
+};
+
+class InputExpr : public Expr {
+public:
+	InputExpr() {};
+
+	Value accept(const ValueVisitor& visitor) const override
+	{
+		return visitor.visit(*this);
+	}
+};
+
+//	superinstructions produced by the optimizer
+//	each one keeps the expression it replaced so that operands the fast path
+//	can't handle (wrong types, bad indices) fall back to the generic path
+
+//	name = name + amount
+class IncrementExpr : public Expr {
+public:
+	Token name;
+	//	the literal, negated for '-', an integer one keeps integer variables
+	//	integers
+	Value amount;
+	std::unique_ptr<Expr> original;
+
+	IncrementExpr(Token name, Value amount, std::unique_ptr<Expr> original)
+		: name(name), amount(amount), original(std::move(original)) {}
+
+	Value accept(const ValueVisitor& visitor) const override
+	{
+		return visitor.visit(*this);
+	}
+};
+
+//	name < constant (and the other relational operators)
+class CompareLocalExpr : public Expr {
+public:
+	Token name;
+	Token op;
+	//	the literal as written, integers compare exactly with integers
+	Value constant;
+	std::unique_ptr<Expr> original;
+
+	CompareLocalExpr(Token name, Token op, Value constant, std::unique_ptr<Expr> original)
+		: name(name), op(op), constant(constant), original(std::move(original)) {}
+
+	Value accept(const ValueVisitor& visitor) const override
+	{
+		return visitor.visit(*this);
+	}
+};
+
+//	array[index + leftOffset] > array[index + rightOffset]
+class CompareAdjacentExpr : public Expr {
+public:
+	Token name;
+	Token index;
+	Token op;
+	double leftOffset;
+	double rightOffset;
+	std::unique_ptr<Expr> original;
+	//	temp slots the elements are stored in for later reuse, -1 if unused
+	int leftSlot = -1;
+	int rightSlot = -1;
+
+	CompareAdjacentExpr(Token name, Token index, Token op, double leftOffset, double rightOffset, std::unique_ptr<Expr> original)
+		: name(name), index(index), op(op), leftOffset(leftOffset), rightOffset(rightOffset), original(std::move(original)) {}
+
+	Value accept(const ValueVisitor& visitor) const override
+	{
+		return visitor.visit(*this);
+	}
+};
+
+//	reads a value the optimizer stored in a temp slot, either hoisted out of a
+//	loop or captured earlier in the same block
+//	hoisted values can fail to compute at loop entry, original is used then
+class TempExpr : public Expr {
+public:
+	int slot;
+	std::unique_ptr<Expr> original;
+	//	value is only reusable while this LoopRange slot holds
+	int rangeSlot = -1;
+
+	TempExpr(int slot, std::unique_ptr<Expr> original)
+		: slot(slot), original(std::move(original)) {}
+
+	Value accept(const ValueVisitor& visitor) const override
+	{
+		return visitor.visit(*this);
+	}
+};
+
+//	evaluates expr and keeps the result in a temp slot for later TempExprs
+class CaptureExpr : public Expr {
+public:
+	int slot;
+	std::unique_ptr<Expr> expr;
+
+	CaptureExpr(int slot, std::unique_ptr<Expr> expr)
+		: slot(slot), expr(std::move(expr)) {}
+
+	Value accept(const ValueVisitor& visitor) const override
+	{
+		return visitor.visit(*this);
+	}
+};
+//	wraps an expression nested too deep to walk recursively
+//	the tree is flattened into post-order once, the interpreter runs the steps
+//	against a value stack and the destructor takes the tree apart in a loop
+class DeepExpr : public Expr {
+public:
+	enum class Step
+	{
+		EVALUATE,	//	leaf, evaluated on its own
+		UNARY,
+		BINARY,
+		ASSIGN,
+		PUSH,
+		ACCESS,
+		INDEX,		//	array set index is checked before its value runs
+		SET,
+		CALL,
+		MAP_ACCESS,
+		MAP_SET,
+		MAP_CONTAINS
+	};
+
+	struct Op
+	{
+		Step step;
+		const Expr* node;
+	};
+
+	std::unique_ptr<Expr> expr;
+	std::vector<Op> ops;
+
+	explicit DeepExpr(std::unique_ptr<Expr> expr);
+	~DeepExpr() override;
+
+	Value accept(const ValueVisitor& visitor) const override
+	{
+		return visitor.visit(*this);
+	}
+};
@@ -0,0 +1,165 @@
+#include "input.h"
+#include <cerrno>
+#include <cstring>
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#else
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+Input::~Input()
+{
+#ifdef _WIN32
+	if (owned)
+		_close(fd);
+#else
+	if (mapping != nullptr)
+		munmap(mapping, mappedSize);
+	if (owned)
+		close(fd);
+#endif
+}
+
+bool Input::open(const std::string& path)
+{
+#ifdef _WIN32
+	int file = _open(path.c_str(), _O_RDONLY | _O_BINARY);
+#else
+	int file = ::open(path.c_str(), O_RDONLY);
+#endif
+	if (file < 0)
+		return false;
+	fd = file;
+	owned = true;
+	return true;
+}
+
+void Input::setText(std::string_view text)
+{
+	data = text.data();
+	size = text.size();
+	position = searched = 0;
+	started = ended = true;
+}
+
+//	a regular file is mapped from the offset the shell left it at, anything
+//	else (a pipe, a terminal) goes through the buffer
+void Input::start()
+{
+	started = true;
+#ifndef _WIN32
+	struct stat info;
+	if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0)
+	{
+		off_t offset = lseek(fd, 0, SEEK_CUR);
+		void* file = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (file != MAP_FAILED && offset >= 0)
+		{
+			mapping = file;
+			mappedSize = info.st_size;
+			data = static_cast<const char*>(file);
+			size = mappedSize;
+			position = searched = static_cast<size_t>(offset);
+			ended = true;
+			return;
+		}
+		if (file != MAP_FAILED)
+			munmap(file, info.st_size);
+	}
+#endif
+	buffer.resize(blockSize);
+	data = buffer.data();
+}
+
+//	moves the unread part to the front and reads behind it, a line that fills
+//	the whole buffer makes it grow
+void Input::fill()
+{
+	size_t unread = size - position;
+	std::memmove(buffer.data(), buffer.data() + position, unread);
+	searched -= position;
+	size = unread;
+	position = 0;
+	if (size == buffer.size())
+		buffer.resize(buffer.size() * 2);
+	data = buffer.data();
+
+	while (true)
+	{
+#ifdef _WIN32
+		int count = _read(fd, buffer.data() + size, static_cast<unsigned>(buffer.size() - size));
+#else
+		ssize_t count = read(fd, buffer.data() + size, buffer.size() - size);
+#endif
+		if (count < 0 && errno == EINTR)
+			continue;
+		if (count <= 0)
+			ended = true;
+		else
+			size += count;
+		return;
+	}
+}
+
+bool Input::readLine(std::string_view& line)
+{
+	if (!started)
+		start();
+
+	while (true)
+	{
+		const char* newline = static_cast<const char*>(std::memchr(data + searched, '\n', size - searched));
+		if (newline != nullptr)
+		{
+			line = std::string_view(data + position, newline - (data + position));
+			position = searched = newline - data + 1;
+			return true;
+		}
+		searched = size;
+
+		if (ended)
+		{
+			//	the last line may end without a '\n'
+			if (position == size)
+				return false;
+			line = std::string_view(data + position, size - position);
+			position = searched = size;
+			return true;
+		}
+		fill();
+	}
+}
+
+bool Input::readLines(std::string_view& lines, size_t atLeast)
+{
+	if (!started)
+		start();
+
+	while (true)
+	{
+		if (ended && position == size)
+			return false;
+
+		if (ended || size - position >= atLeast)
+		{
+			size_t end = size;
+			if (!ended)
+			{
+				while (end > position && data[end - 1] != '\n')
+					end--;
+			}
+			//	without a '\n' in sight the line goes on past what was read
+			if (end > position)
+			{
+				lines = std::string_view(data + position, end - position);
+				position = searched = end;
+				return true;
+			}
+		}
+		fill();
+	}
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstddef>
+
+//	standard input or a file read in large blocks with read(2) (_read on
+//	windows), or mapped whole when it is a regular file, without iostreams
+//	lines are handed out as views, valid until the next call
+class Input
+{
+public:
+	static const size_t blockSize = 1 << 20;
+
+	Input() = default;
+	~Input();
+	//	reads the file instead of standard input, false if it can't be opened
+	bool open(const std::string& path);
+	//	reads the lines of text instead, which has to outlive the reads
+	void setText(std::string_view text);
+	Input(const Input&) = delete;
+	Input& operator=(const Input&) = delete;
+
+	//	the line without its '\n', false once the input is used up
+	bool readLine(std::string_view& line);
+	//	as many whole lines as are at hand, at least atLeast bytes of them
+	//	unless the input ends first, each with its '\n' except maybe the last
+	bool readLines(std::string_view& lines, size_t atLeast);
+
+private:
+	void start();
+	void fill();
+
+	int fd = 0;
+	bool owned = false;
+	bool started = false;
+	//	nothing left to read past size
+	bool ended = false;
+	const char* data = nullptr;
+	size_t size = 0;
+	size_t position = 0;
+	//	no '\n' in position .. searched, so a long line isn't searched again
+	size_t searched = 0;
+	std::vector<char> buffer;
+	void* mapping = nullptr;
+	size_t mappedSize = 0;
+};
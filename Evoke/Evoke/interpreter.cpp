@@ -1,23 +1,129 @@
 #include "interpreter.h"
-#include "vous.h"
+#include "effects.h"
+#include "kernels.h"
+#include "datafile.h"
 #include <iostream>
+#include <cmath>
+#include <exception>
 
-void Interpreter::interpret(std::vector<std::unique_ptr<Stmt>>& statements) const
+Interpreter::Interpreter(Context& context) : environment(std::make_unique<Environment>()), context(&context), output(&context.output), queue(&pending)
 {
+}
+
+bool Interpreter::interpret(const std::vector<std::unique_ptr<Stmt>>& statements, const EventTable& events) const
+{
+	this->events = &events;
+	pending.reset(events.eventCount());
+	if (versions != nullptr)
+		watchSubscribers();
+	open = 0;
 	try {
 		for (const auto& statement : statements)
 		{
 			execute(*statement);
+			drain();
 		}
 	}
 	catch (RuntimeError& error)
 	{
-		Vous::runtimeError(error.token, error.message);
+		pending.truncate(0);
+		Context::runtimeError(*output, error.token, error.message);
+		return false;
+	}
+	return true;
+}
+
+void Interpreter::reset() const
+{
+	environment = std::make_unique<Environment>();
+	if (versions != nullptr)
+	{
+		environment->versions = versions.get();
+		environment->scope = versions->tick();
+	}
+}
+
+void Interpreter::startRecord(std::string_view record, int64_t number) const
+{
+	reset();
+	environment->defineVariable("record", Value(std::string(record)));
+	environment->defineVariable("recordNumber", Value(number));
+}
+
+void Interpreter::useWorkers(unsigned count) const
+{
+	workers.clear();
+	pool.reset();
+	if (count <= 1)
+		return;
+
+	pool = std::make_unique<WorkerPool>(count);
+	for (unsigned i = 1; i < count; i++)
+		workers.push_back(std::unique_ptr<Interpreter>(new Interpreter(Borrowed())));
+}
+
+void Interpreter::useReactive(bool reactive) const
+{
+	versions.reset();
+	environment->versions = nullptr;
+	if (!reactive)
+		return;
+
+	versions = std::make_unique<Versions>();
+	environment->versions = versions.get();
+	environment->scope = versions->tick();
+}
+
+//	a subscriber can be skipped if running it again would only write what it
+//	wrote last time: it does no input or output, evokes nothing, keeps off
+//	arrays and doesn't read a name it writes, so its result depends only on
+//	the names it reads
+void Interpreter::watchSubscribers() const
+{
+	watches.assign(events->size(), Watch());
+	for (size_t event = 0; event < events->eventCount(); event++)
+	{
+		for (size_t i = 0; i < events->count(static_cast<int>(event)); i++)
+		{
+			const Stmt& stmt = *events->subscriber(static_cast<int>(event), i).stmt;
+			Effects effects;
+			effects.addStmt(stmt);
+			bool skippable = !effects.opaque && !effects.input && !effects.output
+				&& effects.arrayReads.empty() && effects.arrayWrites.empty() && effects.arrayDeclares.empty()
+				&& dynamic_cast<const EvokeStmt*>(&stmt) == nullptr;
+			for (const auto& name : effects.reads)
+				skippable = skippable && effects.writes.count(name) == 0 && effects.declares.count(name) == 0;
+			if (!skippable)
+				continue;
+
+			Watch& watch = watches[events->position(static_cast<int>(event), i)];
+			watch.skippable = true;
+			for (const auto* names : { &effects.reads, &effects.writes, &effects.declares })
+			{
+				for (const auto& name : *names)
+					watch.stamps.push_back(versions->stamp(name));
+			}
+		}
+	}
+}
+
+//	nothing it touches was written since it last ran, where names resolved the
+//	same way
+bool Interpreter::upToDate(const Watch& watch) const
+{
+	if (!watch.skippable || !watch.ran || watch.scope != environment->definingScope().scope)
+		return false;
+	for (const unsigned long long* stamp : watch.stamps)
+	{
+		if (*stamp > watch.ranAt)
+			return false;
 	}
+	return true;
 }
 
 void Interpreter::execute(const Stmt& stmt) const
 {
+	dispatches++;
 	stmt.accept(*this);
 }
 
@@ -28,7 +134,7 @@ void Interpreter::executeBlock(const BlockStmt& stmt, std::unique_ptr<Environmen
 	try
 	{
 		this->environment = std::move(environment);
-		this->environment->enclosing = std::move(previous);
+		this->environment->nest(std::move(previous));
 
 		for (const auto& statement : stmt.stmts)
 		{
@@ -51,142 +157,511 @@ void Interpreter::executeBlock(const BlockStmt& stmt, std::unique_ptr<Environmen
 	}
 }
 
-void Interpreter::visit(const UnaryExpr& expr) const
+Value Interpreter::visit(const UnaryExpr& expr) const
 {
-	evaluate(*expr.operand);
-	Value right = currentResult;
+	return unaryOp(expr, evaluate(*expr.operand));
+}
 
+Value Interpreter::unaryOp(const UnaryExpr& expr, const Value& right) const
+{
 	switch (expr.op.type)
 	{
 	case (MINUS):
 		checkNumberOperand(expr.op, right);
-		currentResult = Value(-right.getDouble());
-		break;
+		if (right.getType() == Type::INTEGER && right.getInteger() != INT64_MIN)
+			return Value(-right.getInteger());
+		return Value(-right.getDouble());
 	case (BANG):
 		checkBoolOperands(expr.op, right, right);
-		currentResult = Value(!right.getBool());
+		return Value(!right.getBool());
+	default:
+		//	the parser only makes '-' and '!' unary
 		break;
 	}
+	return right;
 }
 
-void Interpreter::visit(const BinaryExpr& expr) const
+Value Interpreter::visit(const BinaryExpr& expr) const
 {
-	evaluate(*expr.left);
-	Value left = currentResult;
-
-	evaluate(*expr.right);
-	Value right = currentResult;
+	Value left = evaluate(*expr.left);
+	Value right = evaluate(*expr.right);
+	return binaryOp(expr, left, right);
+}
 
+//	two integers stay integers while the result fits, anything else is done
+//	in doubles
+Value Interpreter::binaryOp(const BinaryExpr& expr, const Value& left, const Value& right) const
+{
+	bool integers = left.getType() == Type::INTEGER && right.getType() == Type::INTEGER;
+	int64_t result;
 	switch (expr.op.type)
 	{
 	case MINUS:
 		checkNumberOperands(expr.op, left, right);
-		currentResult = Value(left.getDouble() - right.getDouble());
-		break;
+		if (integers && subtractIntegers(left.getInteger(), right.getInteger(), result))
+			return Value(result);
+		return Value(left.getDouble() - right.getDouble());
 	case SLASH:
 		checkNumberOperands(expr.op, left, right);
 		if (right.getDouble() == 0)
 			throw RuntimeError(expr.op, "Division by zero.");
-		currentResult = Value(left.getDouble() / right.getDouble());
-		break;
+		//	only a quotient without remainder is an integer, 7 / 2 is still 3.5
+		if (integers && !(left.getInteger() == INT64_MIN && right.getInteger() == -1)
+			&& left.getInteger() % right.getInteger() == 0)
+			return Value(left.getInteger() / right.getInteger());
+		return Value(left.getDouble() / right.getDouble());
 	case STAR:
 		checkNumberOperands(expr.op, left, right);
-		currentResult = Value(left.getDouble() * right.getDouble());
-		break;
+		if (integers && multiplyIntegers(left.getInteger(), right.getInteger(), result))
+			return Value(result);
+		return Value(left.getDouble() * right.getDouble());
 	case PERCENT:
 		checkNumberOperands(expr.op, left, right);
-		if (right.getDouble() == 0)
-			throw RuntimeError(expr.op, "Division by zero.");
-		currentResult = Value(double(int(left.getDouble()) % int(right.getDouble())));
-		break;
+		return remainder(expr.op, left, right);
 	case PLUS:
 		checkAddableOperands(expr.op, left, right);
-		currentResult = addValues(expr.op, left, right);
-		break;
+		return addValues(expr.op, left, right);
 	case GREATER:
-		checkNumberOperands(expr.op, left, right);
-		currentResult = Value(left.getDouble() > right.getDouble());
-		break;
 	case GREATER_EQUAL:
-		checkNumberOperands(expr.op, left, right);
-		currentResult = Value(left.getDouble() >= right.getDouble());
-		break;
 	case LESS:
-		checkNumberOperands(expr.op, left, right);
-		currentResult = Value(left.getDouble() < right.getDouble());
-		break;
 	case LESS_EQUAL:
 		checkNumberOperands(expr.op, left, right);
-		currentResult = Value(left.getDouble() <= right.getDouble());
-		break;
+		if (integers)
+			return Value(compareIntegers(expr.op.type, left.getInteger(), right.getInteger()));
+		return Value(compareNumbers(expr.op.type, left.getDouble(), right.getDouble()));
+	case AND:
+	case PIPE:
+	case LESS_LESS:
+	case GREATER_GREATER:
+		return bitwiseOp(expr.op, left, right);
 	case BANG_EQUAL:
-		currentResult = !areValuesEqual(left, right);
-		break;
+		return Value(!areValuesEqual(left, right));
 	case EQUAL_EQUAL:
-		currentResult = areValuesEqual(left, right);
-		break;
+		return Value(areValuesEqual(left, right));
 	case AND_AND:
-		currentResult = isTruthy(left) && isTruthy(right);
-		break;
+		return Value(isTruthy(left) && isTruthy(right));
 	case PIPE_PIPE:
-		currentResult = isTruthy(left) || isTruthy(right);
+		return Value(isTruthy(left) || isTruthy(right));
+	default:
+		//	the parser only makes the operators above binary
 		break;
 	}
+	return right;
 }
 
-void Interpreter::visit(const LiteralExpr& expr) const
+//	copying the literal only bumps a reference count for strings
+Value Interpreter::visit(const LiteralExpr& expr) const
 {
-	currentResult = expr.literal.literal;
+	return expr.literal.literal;
 }
 
-void Interpreter::visit(const VariableExpr& expr) const
+Value Interpreter::visit(const VariableExpr& expr) const
 {
-	currentResult = environment->getVariable(expr.name);
+	return environment->getVariable(expr.name);
 }
 
-void Interpreter::visit(const AssignmentExpr& expr) const
+Value Interpreter::visit(const AssignmentExpr& expr) const
 {
-	evaluate(*expr.value);
-	Value value = currentResult;
+	Value value = evaluate(*expr.value);
 	environment->assignVariable(expr.name, value);
-	currentResult = value;
+	return value;
+}
+
+Value Interpreter::visit(const ArrayPushExpr& expr) const
+{
+	Value value = evaluate(*expr.value);
+	environment->pushArray(expr.name, value);
+	return value;
+}
+
+Value Interpreter::visit(const ArrayAccessExpr& expr) const
+{
+	return readElement(expr, evaluate(*expr.index));
+}
+
+Value Interpreter::readElement(const ArrayAccessExpr& expr, const Value& indexValue) const
+{
+	checkNumberOperand(expr.name, indexValue);
+	//	out of the 64 bit range is out of bounds too, -1 lets the array say so
+	int64_t index;
+	if (!wholeNumber(indexValue, index))
+		index = -1;
+	if (expr.rangeSlot >= 0 && provenArrays[expr.rangeSlot] != nullptr)
+		return provenArrays[expr.rangeSlot]->get(index);
+	return environment->getArrayElement(expr.name, index);
+}
+
+Value Interpreter::visit(const ArraySetExpr& expr) const
+{
+	Value indexValue = evaluate(*expr.index);
+	checkNumberOperand(expr.name, indexValue);
+	Value value = evaluate(*expr.value);
+	writeElement(expr, indexValue, value);
+	return value;
+}
+
+//	the index has been checked to be a number before the value was evaluated
+void Interpreter::writeElement(const ArraySetExpr& expr, const Value& indexValue, const Value& value) const
+{
+	int64_t index;
+	if (!wholeNumber(indexValue, index))
+		index = -1;
+	//	boxing a shared array would move the elements other chunks are writing
+	double number;
+	if (loopScope != nullptr && !Array::packable(value, number))
+	{
+		Array* array = environment->findArray(expr.name.lexeme);
+		if (array != nullptr && array->isPacked() && array == loopScope->findArray(expr.name.lexeme))
+			throw RuntimeError(expr.name, "Parallel loops can only store numbers in shared array '" + expr.name.lexeme + "'.");
+	}
+	if (expr.rangeSlot >= 0 && provenArrays[expr.rangeSlot] != nullptr)
+		provenArrays[expr.rangeSlot]->set(index, value);
+	else
+		environment->setArrayElement(expr.name, index, value);
+}
+
+Value Interpreter::visit(const InputExpr& expr) const
+{
+	return Value(std::string(readInput()));
+}
+
+//	a line of input, empty once it runs out
+std::string_view Interpreter::readInput() const
+{
+	//	a prompt printed on a terminal shows up before waiting for the answer
+	if (context->output.lineFlushed())
+		context->output.flush();
+	std::string_view line;
+	if (!context->input.readLine(line))
+		return std::string_view();
+	return line;
+}
+
+Value Interpreter::visit(const IncrementExpr& expr) const
+{
+	Value* variable = environment->findVariable(expr.name.lexeme);
+	if (variable == nullptr || !variable->isNumber())
+	{
+		//	let the generic path report the error
+		return evaluate(*expr.original);
+	}
+
+	//	like addValues, integers stay integers unless the sum overflows
+	int64_t sum;
+	if (variable->getType() == Type::INTEGER && expr.amount.getType() == Type::INTEGER
+		&& addIntegers(variable->getInteger(), expr.amount.getInteger(), sum))
+		*variable = Value(sum);
+	else
+		*variable = Value(variable->getDouble() + expr.amount.getDouble());
+	if (versions != nullptr)
+		versions->bump(expr.name.lexeme);
+	return *variable;
+}
+
+Value Interpreter::visit(const CompareLocalExpr& expr) const
+{
+	Value* variable = environment->findVariable(expr.name.lexeme);
+	if (variable == nullptr || !variable->isNumber())
+		return evaluate(*expr.original);
+
+	if (variable->getType() == Type::INTEGER && expr.constant.getType() == Type::INTEGER)
+		return Value(compareIntegers(expr.op.type, variable->getInteger(), expr.constant.getInteger()));
+	return Value(compareNumbers(expr.op.type, variable->getDouble(), expr.constant.getDouble()));
+}
+
+Value Interpreter::visit(const CompareAdjacentExpr& expr) const
+{
+	Value* index = environment->findVariable(expr.index.lexeme);
+	Array* array = environment->findArray(expr.name.lexeme);
+	if (index == nullptr || array == nullptr || !index->isNumber())
+		return evaluate(*expr.original);
+
+	//	positions are checked as doubles, a large integer index can't be
+	//	converted to an int before it is known to be in range
+	double left = index->getDouble() + expr.leftOffset;
+	double right = index->getDouble() + expr.rightOffset;
+	double size = static_cast<double>(array->size());
+	if (!(left >= 0 && left < size && right >= 0 && right < size))
+		return evaluate(*expr.original);
+	//	the elements as the generic path reads them, integers compare exactly
+	Value leftValue = array->get(static_cast<size_t>(left));
+	Value rightValue = array->get(static_cast<size_t>(right));
+	if (!leftValue.isNumber() || !rightValue.isNumber())
+		return evaluate(*expr.original);
+
+	bool result;
+	if (leftValue.getType() == Type::INTEGER && rightValue.getType() == Type::INTEGER)
+		result = compareIntegers(expr.op.type, leftValue.getInteger(), rightValue.getInteger());
+	else
+		result = compareNumbers(expr.op.type, leftValue.getDouble(), rightValue.getDouble());
+	if (expr.leftSlot >= 0)
+		storeTemp(expr.leftSlot, leftValue);
+	if (expr.rightSlot >= 0)
+		storeTemp(expr.rightSlot, rightValue);
+	return Value(result);
+}
+
+Value Interpreter::visit(const TempExpr& expr) const
+{
+	bool rangeLost = expr.rangeSlot >= 0
+		&& (static_cast<size_t>(expr.rangeSlot) >= provenArrays.size() || provenArrays[expr.rangeSlot] == nullptr);
+	if (static_cast<size_t>(expr.slot) >= temps.size() || !tempValid[expr.slot] || rangeLost)
+		return evaluate(*expr.original);
+	return temps[expr.slot];
+}
+
+Value Interpreter::visit(const CaptureExpr& expr) const
+{
+	Value value = evaluate(*expr.expr);
+	storeTemp(expr.slot, value);
+	return value;
+}
+
+Value Interpreter::visit(const GroupingExpr& expr) const
+{
+	return evaluate(*expr.expr);
 }
 
-void Interpreter::visit(const ArrayPushExpr& expr) const
+//	runs the flattened steps against a value stack, each step takes its
+//	operands off the top and leaves its result there
+Value Interpreter::visit(const DeepExpr& expr) const
 {
-	evaluate(*expr.value);
-	environment->pushArray(expr.name, currentResult);
+	std::vector<Value> values;
+	for (const auto& op : expr.ops)
+	{
+		dispatches++;
+		switch (op.step)
+		{
+		case DeepExpr::Step::EVALUATE:
+			values.push_back(evaluate(*op.node));
+			break;
+		case DeepExpr::Step::UNARY:
+			values.back() = unaryOp(static_cast<const UnaryExpr&>(*op.node), values.back());
+			break;
+		case DeepExpr::Step::BINARY:
+		{
+			Value right = std::move(values.back());
+			values.pop_back();
+			values.back() = binaryOp(static_cast<const BinaryExpr&>(*op.node), values.back(), right);
+			break;
+		}
+		case DeepExpr::Step::ASSIGN:
+			environment->assignVariable(static_cast<const AssignmentExpr&>(*op.node).name, values.back());
+			break;
+		case DeepExpr::Step::PUSH:
+			environment->pushArray(static_cast<const ArrayPushExpr&>(*op.node).name, values.back());
+			break;
+		case DeepExpr::Step::ACCESS:
+			values.back() = readElement(static_cast<const ArrayAccessExpr&>(*op.node), values.back());
+			break;
+		case DeepExpr::Step::INDEX:
+			checkNumberOperand(static_cast<const ArraySetExpr&>(*op.node).name, values.back());
+			break;
+		case DeepExpr::Step::SET:
+		{
+			Value value = std::move(values.back());
+			values.pop_back();
+			writeElement(static_cast<const ArraySetExpr&>(*op.node), values.back(), value);
+			values.back() = std::move(value);
+			break;
+		}
+		case DeepExpr::Step::CALL:
+		{
+			const CallExpr& call = static_cast<const CallExpr&>(*op.node);
+			size_t first = values.size() - call.arguments.size();
+			Value result = this->call(call, values.data() + first);
+			values.resize(first);
+			values.push_back(std::move(result));
+			break;
+		}
+		case DeepExpr::Step::MAP_ACCESS:
+			values.back() = readKey(static_cast<const MapAccessExpr&>(*op.node), values.back());
+			break;
+		case DeepExpr::Step::MAP_SET:
+		{
+			const MapSetExpr& set = static_cast<const MapSetExpr&>(*op.node);
+			Value value = std::move(values.back());
+			values.pop_back();
+			checkKey(set.name, values.back());
+			environment->getMap(set.name).set(values.back(), value);
+			values.back() = std::move(value);
+			break;
+		}
+		case DeepExpr::Step::MAP_CONTAINS:
+		{
+			const MapContainsExpr& contains = static_cast<const MapContainsExpr&>(*op.node);
+			values.back() = Value(environment->getMap(contains.name).find(values.back()) != nullptr);
+			break;
+		}
+		}
+	}
+	return std::move(values.back());
+}
+
+Value Interpreter::visit(const MapAccessExpr& expr) const
+{
+	return readKey(expr, evaluate(*expr.key));
+}
+
+Value Interpreter::readKey(const MapAccessExpr& expr, const Value& key) const
+{
+	const Value* value = environment->getMap(expr.name).find(key);
+	if (value == nullptr)
+		throw RuntimeError(expr.name, "Key not found in map '" + expr.name.lexeme + "'.");
+	return *value;
+}
+
+Value Interpreter::visit(const MapSetExpr& expr) const
+{
+	Value key = evaluate(*expr.key);
+	Value value = evaluate(*expr.value);
+	checkKey(expr.name, key);
+	environment->getMap(expr.name).set(key, value);
+	return value;
+}
+
+Value Interpreter::visit(const MapContainsExpr& expr) const
+{
+	Value key = evaluate(*expr.key);
+	return Value(environment->getMap(expr.name).find(key) != nullptr);
+}
+
+//	NaN is never equal to itself, it could be stored but not found again
+void Interpreter::checkKey(const Token& name, const Value& key) const
+{
+	if (key.getType() == Type::DOUBLE && std::isnan(key.getDouble()))
+		throw RuntimeError(name, "Map keys can't be NaN.");
+}
+
+Value Interpreter::visit(const CallExpr& expr) const
+{
+	std::vector<Value> arguments;
+	for (const auto& argument : expr.arguments)
+		arguments.push_back(evaluate(*argument));
+	return call(expr, arguments.data());
+}
+
+//	the arguments have been evaluated already, the functions that change an
+//	array return how many elements it has
+Value Interpreter::call(const CallExpr& expr, const Value* arguments) const
+{
+	const Token& name = expr.arrays[0];
+	Array& array = callArray(name);
+	size_t count = array.size();
+	std::vector<double> scratch;
+	switch (expr.builtin)
+	{
+	case Builtin::LEN:
+		break;
+	case Builtin::SUM:
+		return Value(sumNumbers(readNumbers(name, array, scratch), count));
+	case Builtin::MIN:
+	case Builtin::MAX:
+	{
+		if (count == 0)
+			throw RuntimeError(name, "Array '" + name.lexeme + "' is empty.");
+		const double* numbers = readNumbers(name, array, scratch);
+		return Value(expr.builtin == Builtin::MIN ? minNumbers(numbers, count) : maxNumbers(numbers, count));
+	}
+	case Builtin::DOT:
+	{
+		const Token& otherName = expr.arrays[1];
+		Array& other = callArray(otherName);
+		if (other.size() != count)
+			throw RuntimeError(expr.name, "Arrays '" + name.lexeme + "' and '" + otherName.lexeme + "' differ in length.");
+		std::vector<double> otherScratch;
+		const double* numbers = readNumbers(name, array, scratch);
+		return Value(dotNumbers(numbers, readNumbers(otherName, other, otherScratch), count));
+	}
+	case Builtin::FILL:
+		array.fill(arguments[0]);
+		break;
+	case Builtin::SCALE:
+	case Builtin::OFFSET:
+	{
+		checkNumberOperand(expr.name, arguments[0]);
+		double* numbers = writeNumbers(name, array);
+		if (expr.builtin == Builtin::SCALE)
+			scaleNumbers(numbers, count, arguments[0].getDouble());
+		else
+			offsetNumbers(numbers, count, arguments[0].getDouble());
+		break;
+	}
+	case Builtin::COPY:
+	{
+		Array& source = callArray(expr.arrays[1]);
+		if (&source != &array)
+			array = source;
+		count = array.size();
+		break;
+	}
+	case Builtin::SORT:
+		//	the pool is free unless this runs inside one of its batches
+		if (!array.sort(pooled ? nullptr : pool.get()))
+			throw RuntimeError(name, "Array '" + name.lexeme + "' mixes values that can't be sorted together.");
+		break;
+	case Builtin::RESERVE:
+		array.reserve(elementCount(name, arguments[0]));
+		break;
+	case Builtin::LOAD:
+	case Builtin::LOAD_BINARY:
+	{
+		const std::string& path = fileName(expr.name, arguments[0]);
+		//	the pool is free unless this runs inside one of its batches
+		DataFile result = expr.builtin == Builtin::LOAD ? loadText(path, array, pooled ? nullptr : pool.get())
+			: loadBinary(path, array);
+		if (result == DataFile::FAILED)
+			throw RuntimeError(expr.name, "Can't read file '" + path + "'.");
+		if (result == DataFile::MALFORMED)
+			throw RuntimeError(expr.name, expr.builtin == Builtin::LOAD ? "File '" + path + "' holds something other than numbers."
+				: "File '" + path + "' isn't a whole number of doubles.");
+		count = array.size();
+		break;
+	}
+	case Builtin::SAVE:
+	case Builtin::SAVE_BINARY:
+	{
+		const std::string& path = fileName(expr.name, arguments[0]);
+		const double* numbers = readNumbers(name, array, scratch);
+		DataFile result = expr.builtin == Builtin::SAVE ? saveText(path, numbers, count) : saveBinary(path, numbers, count);
+		if (result != DataFile::OK)
+			throw RuntimeError(expr.name, "Can't write file '" + path + "'.");
+		break;
+	}
+	}
+	return Value(static_cast<int64_t>(count));
 }
 
-void Interpreter::visit(const ArrayAccessExpr& expr) const
+const std::string& Interpreter::fileName(const Token& name, const Value& path) const
 {
-	evaluate(*expr.index);
-	checkNumberOperand(expr.name, currentResult);
-	int index = static_cast<int>(currentResult.getDouble());
-	currentResult = environment->getArrayElement(expr.name, index);
+	if (path.getType() != Type::STRING)
+		throw RuntimeError(name, "File name must be a string.");
+	return path.getString();
 }
 
-void Interpreter::visit(const ArraySetExpr& expr) const
+Array& Interpreter::callArray(const Token& name) const
 {
-	evaluate(*expr.index);
-	checkNumberOperand(expr.name, currentResult);
-	int index = static_cast<int>(currentResult.getDouble());
-	evaluate(*expr.value);
-	Value value = currentResult;
-	environment->setArrayElement(expr.name, index, value);
+	Array* array = environment->findArray(name.lexeme);
+	if (array == nullptr)
+		throw RuntimeError(name, "Undefined array '" + name.lexeme + "'.");
+	return *array;
 }
 
-void Interpreter::visit(const InputExpr& expr) const
+//	a boxed array is gathered into scratch rather than packed in place, a
+//	parallel loop may be reading it from several threads
+const double* Interpreter::readNumbers(const Token& name, const Array& array, std::vector<double>& scratch) const
 {
-	std::string input;
-	std::getline(std::cin, input);
-	currentResult = Value(input);
+	const double* numbers;
+	if (!array.readNumbers(numbers, scratch))
+		throw RuntimeError(name, "Array '" + name.lexeme + "' holds something other than numbers.");
+	return numbers;
 }
 
-void Interpreter::visit(const GroupingExpr& expr) const
+double* Interpreter::writeNumbers(const Token& name, Array& array) const
 {
-	evaluate(*expr.expr);
-	currentResult = currentResult;
+	if (!array.repack())
+		throw RuntimeError(name, "Array '" + name.lexeme + "' holds something other than numbers.");
+	return array.data();
 }
 
 void Interpreter::visit(const ExpressionStmt& stmt) const
@@ -196,26 +671,116 @@ void Interpreter::visit(const ExpressionStmt& stmt) const
 
 void Interpreter::visit(const PrintStmt& stmt) const
 {
-	evaluate(*stmt.expr);
-	Value value = currentResult;
-	std::cout << value.toString() << "\n";
+	if (dynamic_cast<const InputExpr*>(stmt.expr.get()) != nullptr)
+	{
+		//	echoing a line copies it from the input buffer to the output one
+		dispatches++;
+		std::string_view line = readInput();
+		output->write(line.data(), line.size());
+		output->put('\n');
+		return;
+	}
+
+	Value value = evaluate(*stmt.expr);
+	if (value.getType() == Type::DOUBLE)
+	{
+		//	formatted in place, a printed number never becomes a string
+		char text[maxNumberLength];
+		output->write(text, formatNumber(value.getDouble(), text));
+	}
+	else if (value.getType() == Type::INTEGER)
+	{
+		char text[maxNumberLength];
+		output->write(text, formatInteger(value.getInteger(), text));
+	}
+	else
+	{
+		output->write(value.toString());
+	}
+	output->put('\n');
 }
 
 void Interpreter::visit(const ByteStmt& stmt) const
 {
 	Value value;
 	if (stmt.initializer != nullptr)
+		value = evaluate(*stmt.initializer);
+
+	environment->defineVariable(stmt.name.lexeme, std::move(value));
+}
+
+void Interpreter::visit(const ArrayStmt& stmt) const
+{
+	if (stmt.constant != nullptr)
+	{
+		environment->defineArray(stmt.name.lexeme, *stmt.constant);
+		return;
+	}
+	if (stmt.slice)
+	{
+		Value first = stmt.first != nullptr ? evaluate(*stmt.first) : Value();
+		Value last = stmt.last != nullptr ? evaluate(*stmt.last) : Value();
+		Array* source = environment->findArray(stmt.source.lexeme);
+		if (source == nullptr)
+			throw RuntimeError(stmt.source, "Undefined array '" + stmt.source.lexeme + "'.");
+		size_t from = stmt.first != nullptr ? sliceBound(stmt.source, first) : 0;
+		size_t to = stmt.last != nullptr ? sliceBound(stmt.source, last) : source->size();
+		if (from > to || to > source->size())
+			throw RuntimeError(stmt.source, "Slice out of bounds for array '" + stmt.source.lexeme + "'.");
+		environment->defineArray(stmt.name.lexeme, source->view(from, to - from));
+		return;
+	}
+	Array array;
+	if (stmt.count != nullptr)
+	{
+		Value value = evaluate(*stmt.elements[0]);
+		array.assign(elementCount(stmt.name, evaluate(*stmt.count)), value);
+	}
+	else
 	{
-		evaluate(*stmt.initializer);
-		value = currentResult;
+		array.reserve(stmt.elements.size());
+		for (const auto& element : stmt.elements)
+			array.push(evaluate(*element));
 	}
+	environment->defineArray(stmt.name.lexeme, std::move(array));
+}
 
-	environment->defineVariable(stmt.name.lexeme, value);
+//	a length or capacity, a whole number that isn't negative
+size_t Interpreter::elementCount(const Token& name, const Value& count) const
+{
+	size_t number;
+	if (!toCount(count, number))
+		throw RuntimeError(name, "Element count for array '" + name.lexeme + "' must be a whole number that isn't negative.");
+	return number;
 }
 
-void Interpreter::visit(const ArrayStmt& stmt) const
+size_t Interpreter::sliceBound(const Token& name, const Value& bound) const
+{
+	size_t number;
+	if (!toCount(bound, number))
+		throw RuntimeError(name, "Slice bounds for array '" + name.lexeme + "' must be whole numbers that aren't negative.");
+	return number;
+}
+
+bool Interpreter::toCount(const Value& value, size_t& count) const
+{
+	int64_t number;
+	if (!value.isNumber() || !wholeNumber(value, number) || number < 0
+		|| (value.getType() == Type::DOUBLE && value.getDouble() != double(number)))
+		return false;
+	count = static_cast<size_t>(number);
+	return true;
+}
+
+void Interpreter::visit(const MapStmt& stmt) const
+{
+	environment->defineMap(stmt.name.lexeme);
+}
+
+void Interpreter::visit(const DeleteStmt& stmt) const
 {
-	environment->defineArray(stmt.name.lexeme);
+	Value key = evaluate(*stmt.key);
+	environment->getMap(stmt.name).remove(key);
 }
 
 void Interpreter::visit(const BlockStmt& stmt) const
@@ -225,39 +790,652 @@ void Interpreter::visit(const BlockStmt& stmt) const
 
 void Interpreter::visit(const IfStmt& stmt) const
 {
-	evaluate(*stmt.condition);
-	if (isTruthy(currentResult))
+	if (isTruthy(evaluate(*stmt.condition)))
 		execute(*stmt.thenBranch);
 	else if (stmt.elseBranch != nullptr)
 		execute(*stmt.elseBranch);
 }
 
+void Interpreter::visit(const DeepStmt& stmt) const
+{
+	executeIterative(*stmt.stmt);
+}
+
+//	executes a statement tree with an explicit frame stack, blocks, ifs and
+//	loops push their children instead of recursing into them
+//	other statements are shallow and go through execute as usual
+void Interpreter::executeIterative(const Stmt& root) const
+{
+	struct Frame
+	{
+		const Stmt* stmt;
+		size_t next;
+	};
+
+	std::vector<Frame> frames;
+	//	blocks whose environment is currently pushed, so an error can unwind them
+	size_t scopes = 0;
+	frames.push_back({ &root, 0 });
+	try
+	{
+		while (!frames.empty())
+		{
+			Frame& frame = frames.back();
+			const Stmt* stmt = frame.stmt;
+			if (const BlockStmt* block = dynamic_cast<const BlockStmt*>(stmt))
+			{
+				if (frame.next == 0)
+				{
+					dispatches++;
+					std::unique_ptr<Environment> inner = std::make_unique<Environment>();
+					inner->nest(std::move(environment));
+					environment = std::move(inner);
+					scopes++;
+				}
+
+				if (frame.next < block->stmts.size())
+				{
+					const Stmt* child = block->stmts[frame.next++].get();
+					frames.push_back({ child, 0 });
+				}
+				else
+				{
+					environment = std::move(environment->enclosing);
+					scopes--;
+					frames.pop_back();
+				}
+			}
+			else if (const IfStmt* ifStmt = dynamic_cast<const IfStmt*>(stmt))
+			{
+				dispatches++;
+				frames.pop_back();
+				if (isTruthy(evaluate(*ifStmt->condition)))
+					frames.push_back({ ifStmt->thenBranch.get(), 0 });
+				else if (ifStmt->elseBranch != nullptr)
+					frames.push_back({ ifStmt->elseBranch.get(), 0 });
+			}
+			else if (const WhileStmt* whileStmt = dynamic_cast<const WhileStmt*>(stmt))
+			{
+				//	the frame stays while the loop runs and rechecks the condition
+				//	each time its body pops
+				if (frame.next++ == 0)
+					dispatches++;
+				if (whileStmt->range != nullptr || !whileStmt->hoisted.empty())
+				{
+					frames.pop_back();
+					executeOptimizedLoop(*whileStmt);
+				}
+				else if (isTruthy(evaluate(*whileStmt->condition)))
+					frames.push_back({ whileStmt->body.get(), 0 });
+				else
+					frames.pop_back();
+			}
+			else if (const DeepStmt* deep = dynamic_cast<const DeepStmt*>(stmt))
+			{
+				frame.stmt = deep->stmt.get();
+			}
+			else
+			{
+				frames.pop_back();
+				execute(*stmt);
+			}
+		}
+	}
+	catch (...)
+	{
+		for (; scopes > 0; scopes--)
+			environment = std::move(environment->enclosing);
+		throw;
+	}
+}
+
+//	a subscriber only runs when its event is evoked
+void Interpreter::visit(const SubscribedStmt& stmt) const
+{
+}
+
+void Interpreter::visit(const EvokeStmt& stmt) const
+{
+	if (stmt.deferred)
+	{
+		post(stmt);
+		return;
+	}
+	if (stmt.condition != nullptr && !isTruthy(evaluate(*stmt.condition)))
+		return;
+	fire(stmt.id, stmt.repeat ? &stmt : nullptr);
+}
+
+//	subscribers run in the scope of the evoke, in the order they subscribed
+//	evokes among them are run on an explicit stack of activations instead of
+//	recursing, and one in tail position replaces the activation it ends, so an
+//	event that keeps evoking itself loops in place
+void Interpreter::fire(int event, const EvokeStmt* repeat) const
+{
+	struct Activation
+	{
+		int event;
+		size_t next;
+		//	'??' evoke that started the activation, rechecked when it finishes
+		const EvokeStmt* repeat;
+		//	queue entries from posted on were posted by this activation, they
+		//	run in order once its subscribers are done, taken is the next one
+		size_t posted;
+		size_t taken;
+	};
+
+	size_t outerOpen = open;
+	std::vector<Activation> activations;
+	activations.push_back({ event, 0, repeat, queue->size(), queue->size() });
+	try
+	{
+		while (!activations.empty())
+		{
+			Activation& top = activations.back();
+			if (top.next == events->count(top.event))
+			{
+				//	a posted event runs on the same stack, its own posts are
+				//	appended after the ones still waiting and dropped when it ends
+				if (top.taken < queue->size())
+				{
+					PendingEvent waiting = (*queue)[top.taken++];
+					if (waiting.repeat != nullptr && !isTruthy(evaluate(*waiting.repeat->condition)))
+						continue;
+					activations.push_back({ waiting.event, 0, waiting.repeat, queue->size(), queue->size() });
+					continue;
+				}
+
+				queue->truncate(top.posted);
+				if (top.repeat != nullptr && isTruthy(evaluate(*top.repeat->condition)))
+				{
+					top.next = 0;
+					top.taken = top.posted;
+				}
+				else
+				{
+					activations.pop_back();
+				}
+				continue;
+			}
+
+			open = top.posted;
+
+			const EventTable::Subscriber& subscriber = events->subscriber(top.event, top.next++);
+			const EvokeStmt* evoke = subscriber.evoke;
+			if (evoke == nullptr)
+			{
+				if (versions != nullptr)
+				{
+					Watch& watch = watches[events->position(top.event, top.next - 1)];
+					if (upToDate(watch))
+						continue;
+					execute(*subscriber.stmt);
+					watch.ran = true;
+					watch.ranAt = versions->now();
+					watch.scope = environment->definingScope().scope;
+				}
+				else if (pool != nullptr && subscriber.independent > 1)
+				{
+					runIndependent(top.event, top.next - 1, subscriber.independent);
+					top.next += subscriber.independent - 1;
+				}
+				else
+				{
+					execute(*subscriber.stmt);
+				}
+				continue;
+			}
+
+			dispatches++;
+			//	a '??' ending the activation it started would loop nested inside it,
+			//	then every level would check the condition once more on the way out
+			//	with a pure condition that is the same as the activation's own recheck
+			//	neither shortcut applies while events the activation posted wait to
+			//	run after it
+			bool settled = queue->size() == top.posted;
+			if (evoke == top.repeat && subscriber.tail && subscriber.pure && settled)
+				continue;
+			if (evoke->condition != nullptr && !isTruthy(evaluate(*evoke->condition)))
+				continue;
+
+			if (subscriber.tail && top.repeat == nullptr && settled)
+				activations.pop_back();
+			activations.push_back({ evoke->id, 0, evoke->repeat ? evoke : nullptr, queue->size(), queue->size() });
+		}
+	}
+	catch (...)
+	{
+		open = outerOpen;
+		throw;
+	}
+	open = outerOpen;
+}
+
+//	'post' queues the event behind the one running now, a '?' guard is checked
+//	here and a '??' guard when the event is taken off the queue
+//	posting an event that is already waiting to run adds nothing
+void Interpreter::post(const EvokeStmt& stmt) const
+{
+	if (!stmt.repeat && stmt.condition != nullptr && !isTruthy(evaluate(*stmt.condition)))
+		return;
+
+	PendingEvent event{ stmt.id, order, stmt.repeat ? &stmt : nullptr };
+	if (shared)
+		queue->pushShared(&event, 1);
+	else if (!queue->push(event, open))
+		throw RuntimeError(stmt.name, "Too many pending events.");
+}
+
+//	events posted outside of any event run after the statement that posted them
+void Interpreter::drain() const
+{
+	for (size_t i = 0; i < queue->size(); i++)
+	{
+		PendingEvent waiting = (*queue)[i];
+		if (waiting.repeat != nullptr && !isTruthy(evaluate(*waiting.repeat->condition)))
+			continue;
+		fire(waiting.event, waiting.repeat);
+	}
+	queue->truncate(0);
+}
+
+//	runs subscribers the event table proved independent on the worker pool
+//	every worker executes in the current scope, the names the batch defines
+//	are added to it first so the workers only assign existing entries
+//	if several fail, the error of the first in subscription order is the one
+//	the sequential run would have reported, and the variables written by the
+//	subscribers after it are put back as if they hadn't run
+void Interpreter::runIndependent(int event, size_t first, size_t count) const
+{
+	struct Saved
+	{
+		size_t index;
+		const std::string* name;
+		bool defined;
+		Value value;
+	};
+	std::vector<Saved> saved;
+	for (size_t i = 1; i < count; i++)
+	{
+		for (const auto& name : events->subscriber(event, first + i).writes)
+		{
+			Value* value = environment->findVariable(name);
+			saved.push_back({ i, &name, value != nullptr, value != nullptr ? *value : Value() });
+		}
+	}
+
+	for (size_t i = 0; i < count; i++)
+	{
+		if (const ByteStmt* byte = dynamic_cast<const ByteStmt*>(events->subscriber(event, first + i).stmt))
+			environment->reserveVariable(byte->name.lexeme);
+	}
+
+	std::vector<unsigned long long> counts;
+	for (const auto& worker : workers)
+	{
+		worker->environment.reset(environment.get());
+		worker->events = events;
+		worker->queue = queue;
+		worker->context = context;
+		worker->output = output;
+		worker->shared = true;
+		counts.push_back(worker->dispatches);
+	}
+
+	//	posts in the batch go through the shared path, tagged with their
+	//	place in the run so the merge can put them back in order
+	std::vector<std::exception_ptr> errors(count);
+	queue->beginShared();
+	shared = true;
+	pooled = true;
+	pool->run(count, [&](size_t index, unsigned worker)
+	{
+		const Interpreter& runner = worker == 0 ? *this : *workers[worker - 1];
+		try
+		{
+			runner.order = static_cast<unsigned>(index);
+			runner.execute(*events->subscriber(event, first + index).stmt);
+		}
+		catch (...)
+		{
+			errors[index] = std::current_exception();
+		}
+	});
+	shared = false;
+	pooled = false;
+	order = 0;
+	long long overflow = queue->endShared(open);
+
+	for (size_t i = 0; i < workers.size(); i++)
+	{
+		workers[i]->environment.release();
+		dispatches += workers[i]->dispatches - counts[i];
+	}
+
+	for (size_t i = 0; i < count; i++)
+	{
+		if (overflow != static_cast<long long>(i) && errors[i] == nullptr)
+			continue;
+		for (const auto& entry : saved)
+		{
+			if (entry.index <= i)
+				continue;
+			if (!entry.defined)
+				environment->removeVariable(*entry.name);
+			else
+				*environment->findVariable(*entry.name) = entry.value;
+		}
+		if (overflow == static_cast<long long>(i))
+		{
+			const Stmt* stmt = events->subscriber(event, first + i).stmt;
+			throw RuntimeError(static_cast<const EvokeStmt*>(stmt)->name, "Too many pending events.");
+		}
+		std::rethrow_exception(errors[i]);
+	}
+}
+
+void Interpreter::visit(const ParallelStmt& stmt) const
+{
+	Value fromValue = evaluate(*stmt.from);
+	checkNumberOperand(stmt.index, fromValue);
+	Value toValue = evaluate(*stmt.to);
+	checkNumberOperand(stmt.index, toValue);
+	double from = fromValue.getDouble();
+	double span = toValue.getDouble() - from;
+	//	a range that runs backwards is empty as in a sequential loop, one that
+	//	can't be counted or is too long to keep slots for is an error
+	if (std::isnan(span) || span >= static_cast<double>(maxParallelCount))
+		throw RuntimeError(stmt.index, "Parallel loops can cover at most " + std::to_string(maxParallelCount) + " indexes.");
+	size_t count = 0;
+	if (stmt.inclusive ? span >= 0 : span > 0)
+		count = static_cast<size_t>(stmt.inclusive ? std::floor(span) + 1 : std::ceil(span));
+
+	const auto& reductions = stmt.reductions;
+	for (const auto& reduction : reductions)
+		checkNumberOperand(reduction.name, environment->getVariable(reduction.name));
+
+	size_t chunks = (count + parallelChunk - 1) / parallelChunk;
+	std::vector<double> partials(chunks * reductions.size());
+	std::vector<std::exception_ptr> errors(chunks);
+
+	//	each chunk has a scope of its own below the loop's, holding the index
+	//	and the chunk's share of every reduction
+	Environment* sharedScope = environment.get();
+	auto runChunk = [&](size_t chunk, const Interpreter& runner)
+	{
+		std::unique_ptr<Environment> scope = std::make_unique<Environment>();
+		scope->nest(std::move(runner.environment));
+		runner.environment = std::move(scope);
+		Environment* outerLoop = runner.loopScope;
+		runner.loopScope = sharedScope;
+		try
+		{
+			for (const auto& reduction : reductions)
+			{
+				double identity = reduction.op.type == PLUS ? 0 : reduction.op.type == STAR ? 1
+					: reduction.op.lexeme == "min" ? INFINITY : -INFINITY;
+				runner.environment->defineVariable(reduction.name.lexeme, Value(identity));
+			}
+			size_t last = std::min(count, (chunk + 1) * parallelChunk);
+			for (size_t i = chunk * parallelChunk; i < last; i++)
+			{
+				int64_t index;
+				if (fromValue.getType() == Type::INTEGER && addIntegers(fromValue.getInteger(), static_cast<int64_t>(i), index))
+					runner.environment->defineVariable(stmt.index.lexeme, Value(index));
+				else
+					runner.environment->defineVariable(stmt.index.lexeme, Value(from + static_cast<double>(i)));
+				runner.execute(*stmt.body);
+			}
+			for (size_t r = 0; r < reductions.size(); r++)
+			{
+				const Value& partial = runner.environment->getVariable(reductions[r].name);
+				if (!partial.isNumber())
+					throw RuntimeError(reductions[r].name, "Reduction '" + reductions[r].name.lexeme + "' has to stay a number.");
+				partials[chunk * reductions.size() + r] = partial.getDouble();
+			}
+		}
+		catch (...)
+		{
+			errors[chunk] = std::current_exception();
+		}
+		runner.loopScope = outerLoop;
+		std::unique_ptr<Environment> outer = std::move(runner.environment->enclosing);
+		runner.environment = std::move(outer);
+	};
+
+	//	a written array that shares its elements with a view could be read
+	//	through the view at another index
+	bool viewed = false;
+	for (const auto& name : stmt.sharedWrites)
+	{
+		Array* array = environment->findArray(name);
+		viewed = viewed || (array != nullptr && array->isShared());
+	}
+
+	//	in order when there is no pool to spare: no workers, inside a batch
+	//	already, in reactive mode where scopes share the version stamps, or
+	//	when written elements are viewed
+	if (pool == nullptr || pooled || versions != nullptr || chunks < 2 || viewed)
+	{
+		for (size_t chunk = 0; chunk < chunks; chunk++)
+		{
+			runChunk(chunk, *this);
+			if (errors[chunk] != nullptr)
+				std::rethrow_exception(errors[chunk]);
+		}
+	}
+	else
+	{
+		std::vector<unsigned long long> counts;
+		for (const auto& worker : workers)
+		{
+			worker->environment.reset(environment.get());
+			worker->events = events;
+			worker->context = context;
+			counts.push_back(worker->dispatches);
+		}
+
+		//	chunks print into buffers of their own, written out in chunk order
+		//	up to the first one that failed, as if they had run in order
+		std::vector<std::string> printed(chunks);
+		pooled = true;
+		pool->run(chunks, [&](size_t chunk, unsigned worker)
+		{
+			const Interpreter& runner = worker == 0 ? *this : *workers[worker - 1];
+			Output* previous = runner.output;
+			Output out(printed[chunk]);
+			runner.output = &out;
+			runChunk(chunk, runner);
+			out.flush();
+			runner.output = previous;
+		});
+		pooled = false;
+
+		for (size_t i = 0; i < workers.size(); i++)
+		{
+			workers[i]->environment.release();
+			dispatches += workers[i]->dispatches - counts[i];
+		}
+		for (size_t chunk = 0; chunk < chunks; chunk++)
+		{
+			output->write(printed[chunk]);
+			if (errors[chunk] != nullptr)
+				std::rethrow_exception(errors[chunk]);
+		}
+	}
+
+	for (size_t r = 0; r < reductions.size(); r++)
+	{
+		const ParallelStmt::Reduction& reduction = reductions[r];
+		double value = environment->getVariable(reduction.name).getDouble();
+		for (size_t chunk = 0; chunk < chunks; chunk++)
+		{
+			double partial = partials[chunk * reductions.size() + r];
+			if (reduction.op.type == PLUS)
+				value += partial;
+			else if (reduction.op.type == STAR)
+				value *= partial;
+			else if (reduction.op.lexeme == "min")
+				value = std::min(value, partial);
+			else
+				value = std::max(value, partial);
+		}
+		environment->assignVariable(reduction.name, Value(value));
+	}
+}
+
 void Interpreter::visit(const WhileStmt& stmt) const
 {
-	evaluate(*stmt.condition);
-	while (isTruthy(currentResult))
+	if (stmt.range != nullptr || !stmt.hoisted.empty())
+	{
+		executeOptimizedLoop(stmt);
+		return;
+	}
+
+	//	condition is reevaluated before every iteration
+	while (isTruthy(evaluate(*stmt.condition)))
 	{
 		execute(*stmt.body);
-		//	must reevaluate condition
-		evaluate(*stmt.condition);
 	}
 }
 
-void Interpreter::evaluate(const Expr& expr) const
+//	does the loop entry work the optimizer set up: checks the array bounds
+//	once so proven accesses can skip their own check, and evaluates the loop
+//	invariant expressions. a hoisted expression that fails here is left
+//	invalid and recomputed in place, where it reports its error as before
+void Interpreter::executeOptimizedLoop(const WhileStmt& stmt) const
+{
+	std::vector<Array*> savedArrays;
+	std::vector<Value> savedTemps;
+	std::vector<char> savedValid;
+	static const std::vector<LoopRange::ArrayBound> noArrays;
+	const auto& arrays = stmt.range != nullptr ? stmt.range->arrays : noArrays;
+
+	//	loops can be re-entered while active, keep the outer activation's state
+	for (const auto& bound : arrays)
+	{
+		if (static_cast<size_t>(bound.slot) >= provenArrays.size())
+			provenArrays.resize(bound.slot + 1, nullptr);
+		savedArrays.push_back(provenArrays[bound.slot]);
+		provenArrays[bound.slot] = nullptr;
+	}
+	for (const auto& hoisted : stmt.hoisted)
+	{
+		if (static_cast<size_t>(hoisted.slot) >= temps.size())
+			storeTemp(hoisted.slot, Value());
+		savedTemps.push_back(temps[hoisted.slot]);
+		savedValid.push_back(tempValid[hoisted.slot]);
+	}
+
+	auto restore = [&]()
+	{
+		for (size_t i = 0; i < arrays.size(); i++)
+			provenArrays[arrays[i].slot] = savedArrays[i];
+		for (size_t i = 0; i < stmt.hoisted.size(); i++)
+		{
+			temps[stmt.hoisted[i].slot] = savedTemps[i];
+			tempValid[stmt.hoisted[i].slot] = savedValid[i];
+		}
+	};
+
+	try
+	{
+		if (stmt.range != nullptr && rangeHolds(*stmt.range))
+		{
+			for (const auto& bound : arrays)
+				provenArrays[bound.slot] = environment->findArray(bound.name.lexeme);
+		}
+
+		for (const auto& hoisted : stmt.hoisted)
+		{
+			try
+			{
+				storeTemp(hoisted.slot, evaluate(*hoisted.expr));
+			}
+			catch (RuntimeError&)
+			{
+				tempValid[hoisted.slot] = false;
+			}
+		}
+
+		while (isTruthy(evaluate(*stmt.condition)))
+		{
+			execute(*stmt.body);
+		}
+	}
+	catch (...)
+	{
+		restore();
+		throw;
+	}
+
+	restore();
+}
+
+void Interpreter::storeTemp(int slot, Value value) const
+{
+	if (static_cast<size_t>(slot) >= temps.size())
+	{
+		temps.resize(slot + 1);
+		tempValid.resize(slot + 1, false);
+	}
+	temps[slot] = std::move(value);
+	tempValid[slot] = true;
+}
+
+//	the index only grows and stays below the limit, so the accessed elements
+//	lie between index + minOffset at entry and the last index + maxOffset
+bool Interpreter::rangeHolds(const LoopRange& range) const
+{
+	Value* index = environment->findVariable(range.index.lexeme);
+	if (index == nullptr || !index->isNumber())
+		return false;
+	double first = index->getDouble();
+	if (first != std::floor(first))
+		return false;
+
+	//	a bad limit is reported by the loop condition itself
+	Value limitValue;
+	try
+	{
+		limitValue = evaluate(*range.limit);
+	}
+	catch (RuntimeError&)
+	{
+		return false;
+	}
+	if (!limitValue.isNumber())
+		return false;
+	double limit = limitValue.getDouble();
+	double last = range.inclusive ? std::floor(limit) : std::ceil(limit) - 1;
+
+	for (const auto& bound : range.arrays)
+	{
+		Array* array = environment->findArray(bound.name.lexeme);
+		if (array == nullptr)
+			return false;
+		if (first + bound.minOffset < 0 || last + bound.maxOffset >= double(array->size()))
+			return false;
+	}
+	return true;
+}
+
+Value Interpreter::evaluate(const Expr& expr) const
 {
-	expr.accept(*this);
+	dispatches++;
+	return expr.accept(*this);
 }
 
 void Interpreter::checkNumberOperand(const Token& op, const Value& operand) const
 {
-	if (operand.getType() == Type::DOUBLE)
+	if (operand.isNumber())
 		return;
 	throw RuntimeError(op, "Operand must be a number");
 }
 
 void Interpreter::checkNumberOperands(const Token& op, const Value& left, const Value& right) const
 {
-	if (left.getType() == Type::DOUBLE && right.getType() == Type::DOUBLE)
+	if (left.isNumber() && right.isNumber())
 		return;
 	throw RuntimeError(op, "Operands must be numbers.");
 }
@@ -267,11 +1445,14 @@ void Interpreter::checkAddableOperands(const Token& op, const Value& left, const
 	switch (left.getType())
 	{
 	case Type::DOUBLE:
+	case Type::INTEGER:
 		return;
 		break;
 	case Type::STRING:
 		return;
 		break;
+	default:
+		break;
 	}
 
 	throw::RuntimeError(op, "Operands must be numbers or strings.");
@@ -286,23 +1467,24 @@ void Interpreter::checkBoolOperands(const Token& op, const Value& left, const Va
 
 bool Interpreter::areValuesEqual(const Value& left, const Value& right) const
 {
-	if (left.getType() != right.getType())
-		return false;
-
-	if (left.getType() == Type::DOUBLE)
-		return left.getDouble() == right.getDouble();
-	if (left.getType() == Type::BOOLEAN)
-		return left.getBool() == right.getBool();
-	return left.getString() == right.getString();
+	//	the rule that tells map keys apart, an integer only equals a double
+	//	when it converts to it exactly
+	return Map::sameKey(left, right);
 }
 
 Value Interpreter::addValues(const Token& op, const Value& left, const Value& right) const
 {
-	if (left.getType() != right.getType())
-		throw::RuntimeError(op, "Type mismatch. Types must match.");
+	if (left.isNumber() && right.isNumber())
+	{
+		int64_t sum;
+		if (left.getType() == Type::INTEGER && right.getType() == Type::INTEGER
+			&& addIntegers(left.getInteger(), right.getInteger(), sum))
+			return Value(sum);
+		return Value(left.getDouble() + right.getDouble());
+	}
 
 	if (left.getType() != right.getType())
-		throw::RuntimeError(Token(), "Type mismatch. Types must match.");
+		throw::RuntimeError(op, "Type mismatch. Types must match.");
 
 	if (left.getType() == Type::DOUBLE)
 		return Value(left.getDouble() + right.getDouble());
@@ -310,6 +1492,107 @@ Value Interpreter::addValues(const Token& op, const Value& left, const Value& ri
 	return Value(left.getString() + right.getString());
 }
 
+bool Interpreter::compareIntegers(TokenType op, int64_t left, int64_t right) const
+{
+	switch (op)
+	{
+	case GREATER:
+		return left > right;
+	case GREATER_EQUAL:
+		return left >= right;
+	case LESS:
+		return left < right;
+	case LESS_EQUAL:
+		return left <= right;
+	default:
+		//	only called with the relational operators
+		break;
+	}
+	return false;
+}
+
+//	'%' works on whole numbers, fractions are cut off first as they always
+//	were. the remainder is exact over the whole 64 bit range
+Value Interpreter::remainder(const Token& op, const Value& left, const Value& right) const
+{
+	int64_t dividend, divisor;
+	if (!wholeNumber(left, dividend) || !wholeNumber(right, divisor))
+	{
+		//	too large for an integer, these are whole anyway
+		if (std::trunc(right.getDouble()) == 0)
+			throw RuntimeError(op, "Division by zero.");
+		return Value(std::fmod(std::trunc(left.getDouble()), std::trunc(right.getDouble())));
+	}
+	if (divisor == 0)
+		throw RuntimeError(op, "Division by zero.");
+	//	INT64_MIN % -1 traps on some processors
+	int64_t rest = divisor == -1 ? 0 : dividend % divisor;
+	if (left.getType() == Type::INTEGER && right.getType() == Type::INTEGER)
+		return Value(rest);
+	return Value(double(rest));
+}
+
+Value Interpreter::bitwiseOp(const Token& op, const Value& left, const Value& right) const
+{
+	int64_t a, b;
+	if (!left.isNumber() || !right.isNumber() || !wholeNumber(left, a) || !wholeNumber(right, b)
+		|| (left.getType() == Type::DOUBLE && left.getDouble() != double(a))
+		|| (right.getType() == Type::DOUBLE && right.getDouble() != double(b)))
+		throw RuntimeError(op, "Operands must be integers.");
+
+	switch (op.type)
+	{
+	case AND:
+		return Value(a & b);
+	case PIPE:
+		return Value(a | b);
+	default:
+		//	the shifts, below
+		break;
+	}
+	if (b < 0 || b > 63)
+		throw RuntimeError(op, "Shift count must be between 0 and 63.");
+	//	'<<' drops the bits shifted out, '>>' keeps the sign
+	if (op.type == LESS_LESS)
+		return Value(static_cast<int64_t>(static_cast<uint64_t>(a) << b));
+	return Value(a >> b);
+}
+
+//	the number cut to an integer, false if it's out of the 64 bit range or NaN
+bool Interpreter::wholeNumber(const Value& value, int64_t& number) const
+{
+	if (value.getType() == Type::INTEGER)
+	{
+		number = value.getInteger();
+		return true;
+	}
+	double truncated = std::trunc(value.getDouble());
+	//	-2^63 is exact as a double, 2^63 is already out of range
+	if (!(truncated >= -9223372036854775808.0 && truncated < 9223372036854775808.0))
+		return false;
+	number = static_cast<int64_t>(truncated);
+	return true;
+}
+
+bool Interpreter::compareNumbers(TokenType op, double left, double right) const
+{
+	switch (op)
+	{
+	case GREATER:
+		return left > right;
+	case GREATER_EQUAL:
+		return left >= right;
+	case LESS:
+		return left < right;
+	case LESS_EQUAL:
+		return left <= right;
+	default:
+		//	only called with the relational operators
+		break;
+	}
+	return false;
+}
+
 bool Interpreter::isTruthy(const Value& value) const
 {
 	switch (value.getType())
@@ -320,6 +1603,11 @@ bool Interpreter::isTruthy(const Value& value) const
 	case Type::DOUBLE:
 		return value.getDouble() != 0;
 		break;
+	case Type::INTEGER:
+		return value.getInteger() != 0;
+		break;
+	default:
+		break;
 	}
 	return true;
 }
@@ -1,50 +1,170 @@
-#pragma once
-#include "expr.h"
-#include "types.h"
-#include "errors.h"
-#include "stmt.h"
-#include "environment.h"
-#include "value.h"
-
-class Interpreter : public ExprVisitor, public StmtVisitor
-{
-public:
-	Interpreter() : environment(std::make_unique<Environment>()) {};
-	void interpret(std::vector<std::unique_ptr<Stmt>>& statements) const;
-
-	//	exprs
-	void visit(const UnaryExpr& expr) const override;
-	void visit(const BinaryExpr& expr) const override;
-	void visit(const GroupingExpr& expr) const override;
-	void visit(const LiteralExpr& expr) const override;
-	void visit(const VariableExpr& expr) const override;
-	void visit(const AssignmentExpr& expr) const override;
-	void visit(const ArrayPushExpr& expr) const override;
-	void visit(const ArrayAccessExpr& expr) const override;
-	void visit(const ArraySetExpr& expr) const override;
-	void visit(const InputExpr& expr) const override;
-
-	//	stmts
-	void visit(const ExpressionStmt& stmt) const override;
-	void visit(const PrintStmt& stmt) const override;
-	void visit(const ByteStmt& stmt) const override;
-	void visit(const ArrayStmt& stmt) const override;
-	void visit(const BlockStmt& stmt) const override;
-	void visit(const IfStmt& stmt) const override;
-	void visit(const WhileStmt& stmt) const override;
-
-private:
-	void execute(const Stmt& stmt) const;
-	void executeBlock(const BlockStmt& stmt, std::unique_ptr<Environment> environment) const;
-	void evaluate(const Expr& expr) const;
-	void checkNumberOperand(const Token& op, const Value& operand) const;
-	void checkNumberOperands(const Token& op, const Value& left, const Value& right) const;
-	void checkAddableOperands(const Token& op, const Value& left, const Value& right) const;
-	void checkBoolOperands(const Token& op, const Value& left, const Value& right) const;
-	bool areValuesEqual(const Value& left, const Value& right) const;
-	Value addValues(const Token& op, const Value& left, const Value& right) const;
-	bool isTruthy(const Value& value) const;
-
-	mutable std::unique_ptr<Environment> environment;
-	mutable Value currentResult;
+#pragma once
+#include "expr.h"
+#include "types.h"
+#include "errors.h"
+#include "stmt.h"
+#include "environment.h"
+#include "value.h"
+#include "events.h"
+#include "pool.h"
+#include "eventqueue.h"
+#include "output.h"
+#include "context.h"
+
+class Interpreter : public ValueVisitor, public StmtVisitor
+{
+public:
+	//	prints to and reads input from context
+	explicit Interpreter(Context& context);
+	//	false if it stopped on a runtime error, which has been reported
+	bool interpret(const std::vector<std::unique_ptr<Stmt>>& statements, const EventTable& events) const;
+	//	run independent subscribers on this many threads, 1 runs everything in order
+	void useWorkers(unsigned count) const;
+	//	skip subscribers whose inputs didn't change since they last ran
+	//	subscribers then run in order even with workers
+	void useReactive(bool reactive) const;
+	//	where print and runtime errors go, the context's output unless set
+	void useOutput(Output& output) const { this->output = &output; }
+	//	a new, empty global scope for running an unrelated program
+	void reset() const;
+	//	batch mode, a new global scope that holds only the record
+	void startRecord(std::string_view record, int64_t number) const;
+
+	//	exprs
+	Value visit(const UnaryExpr& expr) const override;
+	Value visit(const BinaryExpr& expr) const override;
+	Value visit(const GroupingExpr& expr) const override;
+	Value visit(const LiteralExpr& expr) const override;
+	Value visit(const VariableExpr& expr) const override;
+	Value visit(const AssignmentExpr& expr) const override;
+	Value visit(const ArrayPushExpr& expr) const override;
+	Value visit(const ArrayAccessExpr& expr) const override;
+	Value visit(const ArraySetExpr& expr) const override;
+	Value visit(const InputExpr& expr) const override;
+	Value visit(const IncrementExpr& expr) const override;
+	Value visit(const CompareLocalExpr& expr) const override;
+	Value visit(const CompareAdjacentExpr& expr) const override;
+	Value visit(const TempExpr& expr) const override;
+	Value visit(const CaptureExpr& expr) const override;
+	Value visit(const DeepExpr& expr) const override;
+	Value visit(const CallExpr& expr) const override;
+	Value visit(const MapAccessExpr& expr) const override;
+	Value visit(const MapSetExpr& expr) const override;
+	Value visit(const MapContainsExpr& expr) const override;
+
+	//	stmts
+	void visit(const ExpressionStmt& stmt) const override;
+	void visit(const PrintStmt& stmt) const override;
+	void visit(const ByteStmt& stmt) const override;
+	void visit(const ArrayStmt& stmt) const override;
+	void visit(const BlockStmt& stmt) const override;
+	void visit(const IfStmt& stmt) const override;
+	void visit(const WhileStmt& stmt) const override;
+	void visit(const DeepStmt& stmt) const override;
+	void visit(const SubscribedStmt& stmt) const override;
+	void visit(const EvokeStmt& stmt) const override;
+	void visit(const ParallelStmt& stmt) const override;
+	void visit(const MapStmt& stmt) const override;
+	void visit(const DeleteStmt& stmt) const override;
+
+	//	number of expressions and statements dispatched so far
+	unsigned long long dispatchCount() const { return dispatches; }
+
+private:
+	//	worker for the parallel phase, it has no scope of its own and borrows
+	//	the one of the interpreter that started the batch
+	struct Borrowed {};
+	explicit Interpreter(Borrowed) : context(nullptr), output(nullptr) {}
+
+	void execute(const Stmt& stmt) const;
+	void executeBlock(const BlockStmt& stmt, std::unique_ptr<Environment> environment) const;
+	Value evaluate(const Expr& expr) const;
+	void executeOptimizedLoop(const WhileStmt& stmt) const;
+	void executeIterative(const Stmt& root) const;
+	void fire(int event, const EvokeStmt* repeat) const;
+	void runIndependent(int event, size_t first, size_t count) const;
+	void post(const EvokeStmt& stmt) const;
+	void drain() const;
+	std::string_view readInput() const;
+
+	//	what a skippable subscriber touches and when it last ran
+	struct Watch
+	{
+		bool skippable = false;
+		bool ran = false;
+		unsigned long long ranAt = 0;
+		unsigned long long scope = 0;
+		std::vector<const unsigned long long*> stamps;
+	};
+	void watchSubscribers() const;
+	bool upToDate(const Watch& watch) const;
+	Value unaryOp(const UnaryExpr& expr, const Value& right) const;
+	Value binaryOp(const BinaryExpr& expr, const Value& left, const Value& right) const;
+	Value readElement(const ArrayAccessExpr& expr, const Value& indexValue) const;
+	void writeElement(const ArraySetExpr& expr, const Value& indexValue, const Value& value) const;
+	bool rangeHolds(const LoopRange& range) const;
+	Value call(const CallExpr& expr, const Value* arguments) const;
+	Value readKey(const MapAccessExpr& expr, const Value& key) const;
+	void checkKey(const Token& name, const Value& key) const;
+	Array& callArray(const Token& name) const;
+	const std::string& fileName(const Token& name, const Value& path) const;
+	const double* readNumbers(const Token& name, const Array& array, std::vector<double>& scratch) const;
+	double* writeNumbers(const Token& name, Array& array) const;
+	void storeTemp(int slot, Value value) const;
+	void checkNumberOperand(const Token& op, const Value& operand) const;
+	void checkNumberOperands(const Token& op, const Value& left, const Value& right) const;
+	void checkAddableOperands(const Token& op, const Value& left, const Value& right) const;
+	void checkBoolOperands(const Token& op, const Value& left, const Value& right) const;
+	bool areValuesEqual(const Value& left, const Value& right) const;
+	Value addValues(const Token& op, const Value& left, const Value& right) const;
+	bool isTruthy(const Value& value) const;
+	bool compareNumbers(TokenType op, double left, double right) const;
+	bool compareIntegers(TokenType op, int64_t left, int64_t right) const;
+	Value remainder(const Token& op, const Value& left, const Value& right) const;
+	Value bitwiseOp(const Token& op, const Value& left, const Value& right) const;
+	bool wholeNumber(const Value& value, int64_t& number) const;
+	size_t elementCount(const Token& name, const Value& count) const;
+	size_t sliceBound(const Token& name, const Value& bound) const;
+	bool toCount(const Value& value, size_t& count) const;
+
+	mutable std::unique_ptr<Environment> environment;
+	mutable Context* context;
+	mutable Output* output;
+	//	subscribers of the program being interpreted
+	mutable const EventTable* events = nullptr;
+	mutable unsigned long long dispatches = 0;
+	//	arrays resolved at entry of a counted loop, indexed by LoopRange slot
+	//	nullptr means the access has to go through the checked path
+	mutable std::vector<Array*> provenArrays;
+	//	values hoisted out of loops or captured for reuse, indexed by temp slot
+	mutable std::vector<Value> temps;
+	mutable std::vector<char> tempValid;
+	mutable std::unique_ptr<WorkerPool> pool;
+	//	set while the pool runs a batch for this interpreter, work started
+	//	from inside the batch runs in order
+	mutable bool pooled = false;
+	//	scope around the parallel loop being run, the arrays there are shared
+	//	by its chunks and only take numbers, so they stay packed
+	mutable Environment* loopScope = nullptr;
+	mutable std::vector<std::unique_ptr<Interpreter>> workers;
+	//	events queued by 'post', workers post to the queue of the interpreter
+	//	that started the batch
+	mutable EventQueue pending;
+	mutable EventQueue* queue = nullptr;
+	//	start of the entries the running event has posted, coalescing only
+	//	looks at those
+	mutable size_t open = 0;
+	//	set while a parallel run posts through the shared path
+	mutable bool shared = false;
+	mutable unsigned order = 0;
+	//	reactive mode, indexed by position in the event table
+	mutable std::unique_ptr<Versions> versions;
+	mutable std::vector<Watch> watches;
+
+	//	iterations in one chunk of a parallel loop, fixed so the chunks and the
+	//	order their results are folded in don't depend on the thread count
+	static const size_t parallelChunk = 256;
+	//	most indexes one parallel loop covers, every chunk keeps a slot for its
+	//	partials, error and output until the loop ends
+	static constexpr size_t maxParallelCount = size_t(1) << 30;
 };
\ No newline at end of file
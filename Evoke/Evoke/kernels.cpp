@@ -0,0 +1,248 @@
+#include "kernels.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define VOUS_AVX2 __attribute__((target("avx2")))
+#define VOUS_DISPATCH
+#elif defined(__AVX2__)
+#include <immintrin.h>
+#define VOUS_AVX2
+#endif
+
+//	eight lanes, two vectors of four. the partial sums of the lanes are added
+//	as (0+4 + 1+5) + (2+6 + 3+7), the leftover elements one by one after that
+
+//	same operand order as _mm256_min_pd and _mm256_max_pd
+static double lower(double a, double b) { return a < b ? a : b; }
+static double higher(double a, double b) { return a > b ? a : b; }
+
+static double sumScalar(const double* data, size_t count)
+{
+	double lane[8] = {};
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		for (int j = 0; j < 8; j++)
+			lane[j] += data[i + j];
+	}
+	double total = ((lane[0] + lane[4]) + (lane[1] + lane[5])) + ((lane[2] + lane[6]) + (lane[3] + lane[7]));
+	for (; i < count; i++)
+		total += data[i];
+	return total;
+}
+
+static double dotScalar(const double* a, const double* b, size_t count)
+{
+	double lane[8] = {};
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		for (int j = 0; j < 8; j++)
+		{
+			double product = a[i + j] * b[i + j];
+			lane[j] += product;
+		}
+	}
+	double total = ((lane[0] + lane[4]) + (lane[1] + lane[5])) + ((lane[2] + lane[6]) + (lane[3] + lane[7]));
+	for (; i < count; i++)
+	{
+		double product = a[i] * b[i];
+		total += product;
+	}
+	return total;
+}
+
+template<double (*pick)(double, double)>
+static double pickScalar(const double* data, size_t count)
+{
+	size_t i = 0;
+	double result;
+	if (count >= 8)
+	{
+		double lane[8];
+		for (int j = 0; j < 8; j++)
+			lane[j] = data[j];
+		for (i = 8; i + 8 <= count; i += 8)
+		{
+			for (int j = 0; j < 8; j++)
+				lane[j] = pick(lane[j], data[i + j]);
+		}
+		double half[4];
+		for (int j = 0; j < 4; j++)
+			half[j] = pick(lane[j], lane[j + 4]);
+		result = pick(pick(half[0], half[1]), pick(half[2], half[3]));
+	}
+	else
+		result = data[i++];
+	for (; i < count; i++)
+		result = pick(result, data[i]);
+	return result;
+}
+
+#ifdef VOUS_AVX2
+static VOUS_AVX2 double total(__m256d low, __m256d high)
+{
+	alignas(32) double half[4];
+	_mm256_store_pd(half, _mm256_add_pd(low, high));
+	return (half[0] + half[1]) + (half[2] + half[3]);
+}
+
+static VOUS_AVX2 double sumAvx2(const double* data, size_t count)
+{
+	__m256d low = _mm256_setzero_pd(), high = _mm256_setzero_pd();
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		low = _mm256_add_pd(low, _mm256_loadu_pd(data + i));
+		high = _mm256_add_pd(high, _mm256_loadu_pd(data + i + 4));
+	}
+	double result = total(low, high);
+	for (; i < count; i++)
+		result += data[i];
+	return result;
+}
+
+static VOUS_AVX2 double dotAvx2(const double* a, const double* b, size_t count)
+{
+	__m256d low = _mm256_setzero_pd(), high = _mm256_setzero_pd();
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		low = _mm256_add_pd(low, _mm256_mul_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+		high = _mm256_add_pd(high, _mm256_mul_pd(_mm256_loadu_pd(a + i + 4), _mm256_loadu_pd(b + i + 4)));
+	}
+	double result = total(low, high);
+	for (; i < count; i++)
+	{
+		double product = a[i] * b[i];
+		result += product;
+	}
+	return result;
+}
+
+template<bool max>
+static VOUS_AVX2 double pickAvx2(const double* data, size_t count)
+{
+	if (count < 8)
+		return max ? pickScalar<higher>(data, count) : pickScalar<lower>(data, count);
+	__m256d low = _mm256_loadu_pd(data), high = _mm256_loadu_pd(data + 4);
+	size_t i = 8;
+	for (; i + 8 <= count; i += 8)
+	{
+		__m256d nextLow = _mm256_loadu_pd(data + i), nextHigh = _mm256_loadu_pd(data + i + 4);
+		low = max ? _mm256_max_pd(low, nextLow) : _mm256_min_pd(low, nextLow);
+		high = max ? _mm256_max_pd(high, nextHigh) : _mm256_min_pd(high, nextHigh);
+	}
+	alignas(32) double half[4];
+	_mm256_store_pd(half, max ? _mm256_max_pd(low, high) : _mm256_min_pd(low, high));
+	auto pick = max ? higher : lower;
+	double result = pick(pick(half[0], half[1]), pick(half[2], half[3]));
+	for (; i < count; i++)
+		result = pick(result, data[i]);
+	return result;
+}
+
+static VOUS_AVX2 void scaleAvx2(double* data, size_t count, double factor)
+{
+	__m256d by = _mm256_set1_pd(factor);
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+		_mm256_storeu_pd(data + i, _mm256_mul_pd(_mm256_loadu_pd(data + i), by));
+	for (; i < count; i++)
+		data[i] *= factor;
+}
+
+static VOUS_AVX2 void offsetAvx2(double* data, size_t count, double amount)
+{
+	__m256d by = _mm256_set1_pd(amount);
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+		_mm256_storeu_pd(data + i, _mm256_add_pd(_mm256_loadu_pd(data + i), by));
+	for (; i < count; i++)
+		data[i] += amount;
+}
+
+static VOUS_AVX2 void fillAvx2(double* data, size_t count, double value)
+{
+	__m256d with = _mm256_set1_pd(value);
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+		_mm256_storeu_pd(data + i, with);
+	for (; i < count; i++)
+		data[i] = value;
+}
+
+#ifdef VOUS_DISPATCH
+static const bool avx2 = __builtin_cpu_supports("avx2");
+#else
+static const bool avx2 = true;
+#endif
+#else
+static const bool avx2 = false;
+#endif
+
+double sumNumbers(const double* data, size_t count)
+{
+#ifdef VOUS_AVX2
+	if (avx2)
+		return sumAvx2(data, count);
+#endif
+	return sumScalar(data, count);
+}
+
+double dotNumbers(const double* a, const double* b, size_t count)
+{
+#ifdef VOUS_AVX2
+	if (avx2)
+		return dotAvx2(a, b, count);
+#endif
+	return dotScalar(a, b, count);
+}
+
+double minNumbers(const double* data, size_t count)
+{
+#ifdef VOUS_AVX2
+	if (avx2)
+		return pickAvx2<false>(data, count);
+#endif
+	return pickScalar<lower>(data, count);
+}
+
+double maxNumbers(const double* data, size_t count)
+{
+#ifdef VOUS_AVX2
+	if (avx2)
+		return pickAvx2<true>(data, count);
+#endif
+	return pickScalar<higher>(data, count);
+}
+
+void fillNumbers(double* data, size_t count, double value)
+{
+#ifdef VOUS_AVX2
+	if (avx2)
+		return fillAvx2(data, count, value);
+#endif
+	for (size_t i = 0; i < count; i++)
+		data[i] = value;
+}
+
+void scaleNumbers(double* data, size_t count, double factor)
+{
+#ifdef VOUS_AVX2
+	if (avx2)
+		return scaleAvx2(data, count, factor);
+#endif
+	for (size_t i = 0; i < count; i++)
+		data[i] *= factor;
+}
+
+void offsetNumbers(double* data, size_t count, double amount)
+{
+#ifdef VOUS_AVX2
+	if (avx2)
+		return offsetAvx2(data, count, amount);
+#endif
+	for (size_t i = 0; i < count; i++)
+		data[i] += amount;
+}
@@ -0,0 +1,14 @@
+#pragma once
+#include <cstddef>
+
+//	loops over packed numbers behind the built-in array functions. they use
+//	AVX2 when the processor has it, otherwise a scalar loop that adds in the
+//	same lane order, so a script prints the same digits on either
+double sumNumbers(const double* data, size_t count);
+double dotNumbers(const double* a, const double* b, size_t count);
+//	count must not be 0
+double minNumbers(const double* data, size_t count);
+double maxNumbers(const double* data, size_t count);
+void fillNumbers(double* data, size_t count, double value);
+void scaleNumbers(double* data, size_t count, double factor);
+void offsetNumbers(double* data, size_t count, double amount);
@@ -1,26 +1,81 @@
-#include <iostream>
-#include <string>
-#include "vous.h"
-
-int main(int argc, const char* argv[])
-{
-	Vous vous;
-	//std::cout << argc << std::endl;
-
-	if (argc > 2) {
-		std::cout << "Usage: vous [script]\n";
-		return EXIT_FAILURE;
-	}
-
-	if (argc == 2) {
-		vous.runFile(std::string(argv[1]));
-	}
-	else {
-		vous.runPrompt();
-	}
-
-	std::cout << "quit\n";
-
-	std::cin.get();
-	return EXIT_SUCCESS;
-}
\ No newline at end of file
+#include <iostream>
+#include <string>
+#include <thread>
+#include <algorithm>
+#include <cstdlib>
+#include "vous.h"
+#include "server.h"
+
+int main(int argc, const char* argv[])
+{
+	Options options;
+	std::string script;
+	//std::cout << argc << std::endl;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		if (arg == "--no-opt")
+			options.optimize = false;
+		else if (arg == "--stats")
+			options.stats = true;
+		else if (arg == "--reactive")
+			options.reactive = true;
+		else if (arg.rfind("--output=", 0) == 0)
+			options.output = arg.substr(9);
+		else if (arg == "--flush=exit")
+			options.flush = Output::Flush::EXIT;
+		else if (arg == "--flush=line")
+			options.flush = Output::Flush::LINE;
+		else if (arg.rfind("--flush=", 0) == 0 && std::atoi(arg.c_str() + 8) > 0)
+		{
+			options.flush = Output::Flush::SIZE;
+			options.flushBytes = std::atoi(arg.c_str() + 8);
+		}
+		else if (arg == "--dot")
+			options.dot = true;
+		else if (arg == "--parallel")
+			options.threads = std::max(1u, std::thread::hardware_concurrency());
+		else if (arg.rfind("--parallel=", 0) == 0)
+			options.threads = std::max(1, std::atoi(arg.c_str() + 11));
+		else if (arg.rfind("--serve=", 0) == 0)
+			options.serve = arg.substr(8);
+		else if (arg.rfind("--connect=", 0) == 0)
+			options.connect = arg.substr(10);
+		else if (arg == "--batch")
+			options.batch = true;
+		else if (script.empty() && arg.rfind("--", 0) != 0)
+			script = arg;
+		else if (options.batch && arg.rfind("--", 0) != 0)
+			options.inputs.push_back(arg);
+		else {
+			std::cout << "Usage: vous [--stats] [--no-opt] [--parallel[=threads]] [--reactive] [--dot]\n            [--output=file] [--flush=exit|line|bytes] [script]\n       vous --batch [options] script [inputs]\n       vous --serve=socket [--parallel[=threads]] [--no-opt]\n       vous --connect=socket script\n";
+			return EXIT_FAILURE;
+		}
+	}
+
+	if (!options.serve.empty()) {
+		Server server(options);
+		return server.serve(options.serve) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	Vous vous(options);
+
+	if (!options.connect.empty() && !script.empty()) {
+		vous.runRemote(options.connect, script);
+	}
+	else if (options.batch && !script.empty()) {
+		vous.runBatch(script, options.inputs);
+	}
+	else if (!script.empty()) {
+		vous.runFile(script);
+	}
+	else {
+		vous.runPrompt();
+	}
+
+	std::cout << "quit\n";
+
+	std::cin.get();
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,145 @@
+#include "map.h"
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string_view>
+
+//	finalizer of splitmix64, spreads the low bits that pick the slot
+static size_t mix(uint64_t x)
+{
+	x ^= x >> 30;
+	x *= 0xbf58476d1ce4e5b9ULL;
+	x ^= x >> 27;
+	x *= 0x94d049bb133111ebULL;
+	x ^= x >> 31;
+	return static_cast<size_t>(x);
+}
+
+size_t Map::hash(const Value& key)
+{
+	size_t h;
+	switch (key.getType())
+	{
+	case Type::INTEGER:
+		//	an integer that equals a double hashes like it, 1 and 1.0 are one key
+		if (!exactDouble(key.getInteger()))
+		{
+			h = mix(static_cast<uint64_t>(key.getInteger()));
+			break;
+		}
+		//	fall through
+	case Type::DOUBLE:
+	{
+		//	0 and -0 are the same key
+		double number = key.getDouble() == 0 ? 0 : key.getDouble();
+		uint64_t bits;
+		std::memcpy(&bits, &number, sizeof bits);
+		h = mix(bits);
+		break;
+	}
+	case Type::STRING:
+		h = mix(std::hash<std::string_view>()(key.getString()) + 1);
+		break;
+	default:
+		h = mix(key.getBool() ? 2 : 3);
+		break;
+	}
+	return h != 0 ? h : 1;
+}
+
+bool Map::sameKey(const Value& a, const Value& b)
+{
+	if (a.isNumber() && b.isNumber())
+	{
+		if (a.getType() == Type::INTEGER && b.getType() == Type::INTEGER)
+			return a.getInteger() == b.getInteger();
+		const Value& integer = a.getType() == Type::INTEGER ? a : b;
+		if (integer.getType() == Type::INTEGER && !exactDouble(integer.getInteger()))
+			return false;
+		return a.getDouble() == b.getDouble();
+	}
+	if (a.getType() != b.getType())
+		return false;
+	switch (a.getType())
+	{
+	case Type::STRING:
+		return a.sharesString(b) || a.getString() == b.getString();
+	default:
+		return a.getBool() == b.getBool();
+	}
+}
+
+size_t Map::probe(const Value& key, size_t hash) const
+{
+	size_t mask = slots.size() - 1;
+	size_t i = hash & mask;
+	while (slots[i].hash != 0 && (slots[i].hash != hash || !sameKey(slots[i].key, key)))
+		i = (i + 1) & mask;
+	return i;
+}
+
+const Value* Map::find(const Value& key) const
+{
+	if (count == 0)
+		return nullptr;
+	const Slot& slot = slots[probe(key, hash(key))];
+	return slot.hash != 0 ? &slot.value : nullptr;
+}
+
+void Map::set(const Value& key, const Value& value)
+{
+	//	at most three quarters full, so every probe sequence ends
+	if ((count + 1) * 4 > slots.size() * 3)
+		grow();
+	size_t h = hash(key);
+	Slot& slot = slots[probe(key, h)];
+	if (slot.hash == 0)
+	{
+		slot.hash = h;
+		slot.key = key;
+		count++;
+	}
+	slot.value = value;
+}
+
+//	later entries of the cluster move back into the hole, so no probe
+//	sequence is cut short and no tombstones pile up
+bool Map::remove(const Value& key)
+{
+	if (count == 0)
+		return false;
+	size_t mask = slots.size() - 1;
+	size_t hole = probe(key, hash(key));
+	if (slots[hole].hash == 0)
+		return false;
+
+	for (size_t i = (hole + 1) & mask; slots[i].hash != 0; i = (i + 1) & mask)
+	{
+		//	an entry can fill the hole if the hole is on its way from its home slot
+		size_t home = slots[i].hash & mask;
+		if (((i - home) & mask) >= ((i - hole) & mask))
+		{
+			slots[hole] = std::move(slots[i]);
+			hole = i;
+		}
+	}
+	slots[hole] = Slot();
+	count--;
+	return true;
+}
+
+void Map::grow()
+{
+	std::vector<Slot> old = std::move(slots);
+	slots = std::vector<Slot>(old.empty() ? 8 : old.size() * 2);
+	size_t mask = slots.size() - 1;
+	for (auto& slot : old)
+	{
+		if (slot.hash == 0)
+			continue;
+		size_t i = slot.hash & mask;
+		while (slots[i].hash != 0)
+			i = (i + 1) & mask;
+		slots[i] = std::move(slot);
+	}
+}
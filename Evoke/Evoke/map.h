@@ -0,0 +1,39 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include "value.h"
+
+//	var{} maps, open addressing with linear probing. every slot keeps the hash
+//	of its key, so a probe only compares keys whose hashes match and growing
+//	never hashes a key again. string keys compare by buffer first, literals
+//	are interned by the scanner so the same literal finds its key that way
+class Map
+{
+public:
+	size_t size() const { return count; }
+	//	nullptr if the key isn't there
+	const Value* find(const Value& key) const;
+	void set(const Value& key, const Value& value);
+	//	false if the key wasn't there
+	bool remove(const Value& key);
+	//	whether two values are one key, an integer only matches a double it
+	//	converts to exactly. '==' follows the same rule
+	static bool sameKey(const Value& a, const Value& b);
+
+private:
+	struct Slot
+	{
+		//	0 marks an empty slot
+		size_t hash = 0;
+		Value key;
+		Value value;
+	};
+
+	static size_t hash(const Value& key);
+	//	the slot holding key, or the empty slot ending its probe sequence
+	size_t probe(const Value& key, size_t hash) const;
+	void grow();
+
+	std::vector<Slot> slots;
+	size_t count = 0;
+};
@@ -0,0 +1,93 @@
+#include "mapping.h"
+#include <cerrno>
+#include <algorithm>
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#else
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+Mapping::~Mapping()
+{
+#ifndef _WIN32
+	if (mapped)
+		munmap(bytes, length);
+#endif
+}
+
+bool Mapping::open(const std::string& path)
+{
+#ifdef _WIN32
+	int fd = _open(path.c_str(), _O_RDONLY | _O_BINARY);
+	struct _stat64 info;
+	if (fd < 0)
+		return false;
+	if (_fstat64(fd, &info) != 0)
+	{
+		_close(fd);
+		return false;
+	}
+#else
+	int fd = ::open(path.c_str(), O_RDONLY);
+	struct stat info;
+	if (fd < 0)
+		return false;
+	if (fstat(fd, &info) != 0)
+	{
+		close(fd);
+		return false;
+	}
+#endif
+	length = static_cast<size_t>(info.st_size);
+	if (length == 0)
+	{
+#ifdef _WIN32
+		_close(fd);
+#else
+		close(fd);
+#endif
+		return true;
+	}
+
+#ifndef _WIN32
+	void* file = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	if (file != MAP_FAILED)
+	{
+		close(fd);
+		bytes = static_cast<char*>(file);
+		mapped = true;
+		return true;
+	}
+#endif
+
+	//	the buffer holds doubles so the bytes are aligned for them
+	buffer.resize((length + sizeof(double) - 1) / sizeof(double));
+	bytes = reinterpret_cast<char*>(buffer.data());
+	size_t done = 0;
+	while (done < length)
+	{
+#ifdef _WIN32
+		int count = _read(fd, bytes + done, static_cast<unsigned>(std::min<size_t>(length - done, 1 << 30)));
+#else
+		ssize_t count = read(fd, bytes + done, length - done);
+#endif
+		if (count < 0 && errno == EINTR)
+			continue;
+		if (count <= 0)
+			break;
+		done += count;
+	}
+#ifdef _WIN32
+	_close(fd);
+#else
+	close(fd);
+#endif
+	//	the file got shorter while it was read
+	length = done;
+	return true;
+}
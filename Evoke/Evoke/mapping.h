@@ -0,0 +1,29 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstddef>
+
+//	a whole file mapped privately into memory. the pages can be written, the
+//	system copies a page the first time it is and the file never changes. on
+//	windows, or where the file can't be mapped, it is read into memory instead
+class Mapping
+{
+public:
+	Mapping() = default;
+	~Mapping();
+	Mapping(const Mapping&) = delete;
+	Mapping& operator=(const Mapping&) = delete;
+
+	//	false if the file can't be opened or read
+	bool open(const std::string& path);
+
+	//	aligned for doubles, nullptr for an empty file
+	char* data() { return bytes; }
+	size_t size() const { return length; }
+
+private:
+	char* bytes = nullptr;
+	size_t length = 0;
+	bool mapped = false;
+	std::vector<double> buffer;
+};
@@ -0,0 +1,44 @@
+#include "numbers.h"
+#include <charconv>
+#include <cmath>
+
+//	below 2^53 every integer is exact, fixed notation is what people expect for
+//	counters and sizes even where an exponent would be shorter
+size_t formatNumber(double value, char* out)
+{
+	std::to_chars_result result;
+	if (value == std::trunc(value) && std::fabs(value) < 9007199254740992.0)
+		result = std::to_chars(out, out + maxNumberLength, value, std::chars_format::fixed);
+	else
+		result = std::to_chars(out, out + maxNumberLength, value);
+	return result.ptr - out;
+}
+
+std::string formatNumber(double value)
+{
+	char text[maxNumberLength];
+	return std::string(text, formatNumber(value, text));
+}
+
+double parseNumber(const char* begin, const char* end)
+{
+	double value = 0;
+	std::from_chars(begin, end, value);
+	return value;
+}
+
+size_t formatInteger(int64_t value, char* out)
+{
+	return std::to_chars(out, out + maxNumberLength, value).ptr - out;
+}
+
+std::string formatInteger(int64_t value)
+{
+	char text[maxNumberLength];
+	return std::string(text, formatInteger(value, text));
+}
+
+bool parseInteger(const char* begin, const char* end, int64_t& value)
+{
+	return std::from_chars(begin, end, value).ec == std::errc();
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+//	room formatNumber needs, the longest double is "-2.2250738585072014e-308"
+const size_t maxNumberLength = 32;
+
+//	shortest text that reads back as the same double, integers print without
+//	a fraction or an exponent. writes no terminator, returns the length
+size_t formatNumber(double value, char* out);
+std::string formatNumber(double value);
+
+size_t formatInteger(int64_t value, char* out);
+std::string formatInteger(int64_t value);
+
+//	reads a number literal in place, the scanner has already checked the
+//	digits so this can't fail
+double parseNumber(const char* begin, const char* end);
+//	false if the digits don't fit in 64 bits
+bool parseInteger(const char* begin, const char* end, int64_t& value);
+
+//	integers up to 2^53 convert to a double and back unchanged
+inline bool exactDouble(int64_t value)
+{
+	const int64_t limit = int64_t(1) << 53;
+	return value >= -limit && value <= limit;
+}
+
+//	integer arithmetic that reports overflow instead of wrapping, the caller
+//	then falls back to doubles
+inline bool addIntegers(int64_t a, int64_t b, int64_t& result)
+{
+#ifdef __GNUC__
+	return !__builtin_add_overflow(a, b, &result);
+#else
+	if ((b > 0 && a > INT64_MAX - b) || (b < 0 && a < INT64_MIN - b))
+		return false;
+	result = a + b;
+	return true;
+#endif
+}
+
+inline bool subtractIntegers(int64_t a, int64_t b, int64_t& result)
+{
+#ifdef __GNUC__
+	return !__builtin_sub_overflow(a, b, &result);
+#else
+	if ((b < 0 && a > INT64_MAX + b) || (b > 0 && a < INT64_MIN + b))
+		return false;
+	result = a - b;
+	return true;
+#endif
+}
+
+inline bool multiplyIntegers(int64_t a, int64_t b, int64_t& result)
+{
+#ifdef __GNUC__
+	return !__builtin_mul_overflow(a, b, &result);
+#else
+	if (a > 0 ? (b > 0 ? a > INT64_MAX / b : b < INT64_MIN / a)
+		: (b > 0 ? a < INT64_MIN / b : a != 0 && b < INT64_MAX / a))
+		return false;
+	result = a * b;
+	return true;
+#endif
+}
@@ -0,0 +1,998 @@
+#include "optimizer.h"
+#include <cmath>
+
+void Optimizer::optimize(std::vector<std::unique_ptr<Stmt>>& statements, const std::set<std::string>& views)
+{
+	this->views = views;
+	for (auto& statement : statements)
+	{
+		optimizeStmt(statement);
+	}
+
+	//	the whole program is one region, top level statements run in order
+	std::vector<Available> available;
+	for (auto& statement : statements)
+	{
+		eliminateStmt(statement, available);
+	}
+}
+
+void Optimizer::optimizeStmt(std::unique_ptr<Stmt>& stmt)
+{
+	//	parser leaves nullptr behind for statements it failed to parse
+	if (stmt == nullptr)
+		return;
+
+	if (PrintStmt* print = dynamic_cast<PrintStmt*>(stmt.get()))
+	{
+		optimizeExpr(print->expr);
+	}
+	else if (ExpressionStmt* expression = dynamic_cast<ExpressionStmt*>(stmt.get()))
+	{
+		optimizeExpr(expression->expr);
+	}
+	else if (ByteStmt* byte = dynamic_cast<ByteStmt*>(stmt.get()))
+	{
+		if (byte->initializer != nullptr)
+			optimizeExpr(byte->initializer);
+	}
+	else if (ArrayStmt* array = dynamic_cast<ArrayStmt*>(stmt.get()))
+	{
+		for (auto& element : array->elements)
+			optimizeExpr(element);
+		if (array->count != nullptr)
+			optimizeExpr(array->count);
+		if (array->first != nullptr)
+			optimizeExpr(array->first);
+		if (array->last != nullptr)
+			optimizeExpr(array->last);
+	}
+	else if (BlockStmt* block = dynamic_cast<BlockStmt*>(stmt.get()))
+	{
+		for (auto& statement : block->stmts)
+			optimizeStmt(statement);
+	}
+	else if (IfStmt* ifStmt = dynamic_cast<IfStmt*>(stmt.get()))
+	{
+		optimizeExpr(ifStmt->condition);
+		optimizeStmt(ifStmt->thenBranch);
+		if (ifStmt->elseBranch != nullptr)
+			optimizeStmt(ifStmt->elseBranch);
+	}
+	else if (WhileStmt* whileStmt = dynamic_cast<WhileStmt*>(stmt.get()))
+	{
+		//	analyze before fusing, the analysis looks at the plain tree
+		analyzeRange(*whileStmt);
+		optimizeExpr(whileStmt->condition);
+		optimizeStmt(whileStmt->body);
+		//	inner loops are done first, their invariants stay at their own entry
+		hoistInvariants(*whileStmt);
+	}
+	else if (ParallelStmt* parallel = dynamic_cast<ParallelStmt*>(stmt.get()))
+	{
+		optimizeExpr(parallel->from);
+		optimizeExpr(parallel->to);
+		optimizeStmt(parallel->body);
+	}
+	else if (SubscribedStmt* subscribed = dynamic_cast<SubscribedStmt*>(stmt.get()))
+	{
+		optimizeStmt(subscribed->stmt);
+	}
+	else if (EvokeStmt* evoke = dynamic_cast<EvokeStmt*>(stmt.get()))
+	{
+		if (evoke->condition != nullptr)
+			optimizeExpr(evoke->condition);
+	}
+	else if (DeleteStmt* deleteStmt = dynamic_cast<DeleteStmt*>(stmt.get()))
+	{
+		optimizeExpr(deleteStmt->key);
+	}
+}
+
+void Optimizer::optimizeExpr(std::unique_ptr<Expr>& expr)
+{
+	//	optimize children first so patterns are matched bottom up
+	if (UnaryExpr* unary = dynamic_cast<UnaryExpr*>(expr.get()))
+	{
+		optimizeExpr(unary->operand);
+	}
+	else if (BinaryExpr* binary = dynamic_cast<BinaryExpr*>(expr.get()))
+	{
+		//	fuse before touching the operands, the patterns look at the plain tree
+		if (auto fused = fuseCompareAdjacent(expr))
+		{
+			expr = std::move(fused);
+			return;
+		}
+		if (auto fused = fuseCompareLocal(expr))
+		{
+			expr = std::move(fused);
+			return;
+		}
+		optimizeExpr(binary->left);
+		optimizeExpr(binary->right);
+	}
+	else if (GroupingExpr* grouping = dynamic_cast<GroupingExpr*>(expr.get()))
+	{
+		optimizeExpr(grouping->expr);
+	}
+	else if (AssignmentExpr* assignment = dynamic_cast<AssignmentExpr*>(expr.get()))
+	{
+		if (auto fused = fuseIncrement(expr))
+		{
+			expr = std::move(fused);
+			return;
+		}
+		optimizeExpr(assignment->value);
+	}
+	else if (ArrayPushExpr* push = dynamic_cast<ArrayPushExpr*>(expr.get()))
+	{
+		optimizeExpr(push->value);
+	}
+	else if (ArrayAccessExpr* access = dynamic_cast<ArrayAccessExpr*>(expr.get()))
+	{
+		optimizeExpr(access->index);
+	}
+	else if (ArraySetExpr* set = dynamic_cast<ArraySetExpr*>(expr.get()))
+	{
+		optimizeExpr(set->index);
+		optimizeExpr(set->value);
+	}
+	else if (CallExpr* call = dynamic_cast<CallExpr*>(expr.get()))
+	{
+		for (auto& argument : call->arguments)
+			optimizeExpr(argument);
+	}
+	else if (MapAccessExpr* access = dynamic_cast<MapAccessExpr*>(expr.get()))
+	{
+		optimizeExpr(access->key);
+	}
+	else if (MapSetExpr* set = dynamic_cast<MapSetExpr*>(expr.get()))
+	{
+		optimizeExpr(set->key);
+		optimizeExpr(set->value);
+	}
+	else if (MapContainsExpr* contains = dynamic_cast<MapContainsExpr*>(expr.get()))
+	{
+		optimizeExpr(contains->key);
+	}
+}
+
+//	name = name + constant / name = name - constant
+std::unique_ptr<Expr> Optimizer::fuseIncrement(std::unique_ptr<Expr>& expr)
+{
+	AssignmentExpr* assignment = dynamic_cast<AssignmentExpr*>(expr.get());
+	BinaryExpr* binary = dynamic_cast<BinaryExpr*>(assignment->value.get());
+	if (binary == nullptr || (binary->op.type != PLUS && binary->op.type != MINUS))
+		return nullptr;
+
+	VariableExpr* variable = dynamic_cast<VariableExpr*>(binary->left.get());
+	double amount;
+	if (variable == nullptr || variable->name.lexeme != assignment->name.lexeme)
+		return nullptr;
+	if (!isNumberLiteral(binary->right.get(), amount))
+		return nullptr;
+	//	literals aren't negative, so an integer one negates without overflow
+	Value literal = static_cast<const LiteralExpr*>(binary->right.get())->literal.literal;
+	if (binary->op.type == MINUS)
+		literal = literal.getType() == Type::INTEGER ? Value(-literal.getInteger()) : Value(-amount);
+
+	Token name = assignment->name;
+	return std::make_unique<IncrementExpr>(name, literal, std::move(expr));
+}
+
+//	name < constant
+std::unique_ptr<Expr> Optimizer::fuseCompareLocal(std::unique_ptr<Expr>& expr)
+{
+	BinaryExpr* binary = dynamic_cast<BinaryExpr*>(expr.get());
+	if (!isRelational(binary->op.type))
+		return nullptr;
+
+	VariableExpr* variable = dynamic_cast<VariableExpr*>(binary->left.get());
+	double constant;
+	if (variable == nullptr || !isNumberLiteral(binary->right.get(), constant))
+		return nullptr;
+
+	Token name = variable->name;
+	Token op = binary->op;
+	const Value& literal = static_cast<const LiteralExpr*>(binary->right.get())->literal.literal;
+	return std::make_unique<CompareLocalExpr>(name, op, literal, std::move(expr));
+}
+
+//	array[j] > array[j + 1]
+std::unique_ptr<Expr> Optimizer::fuseCompareAdjacent(std::unique_ptr<Expr>& expr)
+{
+	BinaryExpr* binary = dynamic_cast<BinaryExpr*>(expr.get());
+	if (!isRelational(binary->op.type))
+		return nullptr;
+
+	ArrayAccessExpr* left = dynamic_cast<ArrayAccessExpr*>(binary->left.get());
+	ArrayAccessExpr* right = dynamic_cast<ArrayAccessExpr*>(binary->right.get());
+	if (left == nullptr || right == nullptr || left->name.lexeme != right->name.lexeme)
+		return nullptr;
+
+	Token leftIndex, rightIndex;
+	double leftOffset, rightOffset;
+	if (!isIndexOffset(left->index.get(), leftIndex, leftOffset))
+		return nullptr;
+	if (!isIndexOffset(right->index.get(), rightIndex, rightOffset))
+		return nullptr;
+	if (leftIndex.lexeme != rightIndex.lexeme)
+		return nullptr;
+
+	Token name = left->name;
+	Token op = binary->op;
+	return std::make_unique<CompareAdjacentExpr>(name, leftIndex, op, leftOffset, rightOffset, std::move(expr));
+}
+
+//	recognises
+//		while (index < limit) { ...; index = index + step; }
+//	which is also the shape forStatement desugars into
+//	the limit must be loop invariant and the body must not touch the index
+void Optimizer::analyzeRange(WhileStmt& loop)
+{
+	BinaryExpr* condition = dynamic_cast<BinaryExpr*>(loop.condition.get());
+	if (condition == nullptr || (condition->op.type != LESS && condition->op.type != LESS_EQUAL))
+		return;
+	VariableExpr* index = dynamic_cast<VariableExpr*>(condition->left.get());
+	BlockStmt* body = dynamic_cast<BlockStmt*>(loop.body.get());
+	if (index == nullptr || body == nullptr || body->stmts.empty())
+		return;
+
+	//	the last statement must step the index forward by a whole number
+	ExpressionStmt* last = dynamic_cast<ExpressionStmt*>(body->stmts.back().get());
+	AssignmentExpr* increment = last != nullptr ? dynamic_cast<AssignmentExpr*>(last->expr.get()) : nullptr;
+	if (increment == nullptr || increment->name.lexeme != index->name.lexeme)
+		return;
+	BinaryExpr* step = dynamic_cast<BinaryExpr*>(increment->value.get());
+	VariableExpr* stepVariable = step != nullptr ? dynamic_cast<VariableExpr*>(step->left.get()) : nullptr;
+	double amount;
+	if (stepVariable == nullptr || step->op.type != PLUS || stepVariable->name.lexeme != index->name.lexeme)
+		return;
+	if (!isNumberLiteral(step->right.get(), amount) || amount < 1 || amount != std::floor(amount))
+		return;
+
+	Effects effects;
+	for (size_t i = 0; i + 1 < body->stmts.size(); i++)
+	{
+		if (body->stmts[i] == nullptr)
+			return;
+		effects.addStmt(*body->stmts[i]);
+	}
+	effects.widen(views);
+	if (effects.mayChange(index->name.lexeme))
+		return;
+
+	std::unique_ptr<Expr> limit = clonePure(condition->right.get());
+	if (limit == nullptr)
+		return;
+	Effects limitEffects;
+	limitEffects.addExpr(*limit);
+	for (const auto& name : limitEffects.reads)
+	{
+		if (name == index->name.lexeme || effects.mayChange(name))
+			return;
+	}
+	for (const auto& name : limitEffects.arrayReads)
+	{
+		if (effects.mayChangeArray(name))
+			return;
+	}
+
+	auto range = std::make_unique<LoopRange>();
+	range->index = index->name;
+	range->limit = std::move(limit);
+	range->inclusive = condition->op.type == LESS_EQUAL;
+
+	std::vector<Expr*> accesses;
+	for (size_t i = 0; i + 1 < body->stmts.size(); i++)
+		collectAccesses(body->stmts[i].get(), accesses);
+
+	for (Expr* access : accesses)
+	{
+		ArrayAccessExpr* read = dynamic_cast<ArrayAccessExpr*>(access);
+		ArraySetExpr* write = dynamic_cast<ArraySetExpr*>(access);
+		Token name = read != nullptr ? read->name : write->name;
+		Expr* indexExpr = read != nullptr ? read->index.get() : write->index.get();
+
+		Token accessIndex;
+		double offset;
+		if (!isIndexOffset(indexExpr, accessIndex, offset) || accessIndex.lexeme != index->name.lexeme)
+			continue;
+		//	a redeclared array could be shorter than the one checked at entry
+		if (offset != std::floor(offset) || effects.arrayDeclares.count(name.lexeme))
+			continue;
+
+		LoopRange::ArrayBound* bound = nullptr;
+		for (auto& existing : range->arrays)
+		{
+			if (existing.name.lexeme == name.lexeme)
+				bound = &existing;
+		}
+		if (bound == nullptr)
+		{
+			range->arrays.push_back({ name, offset, offset, nextRangeSlot++ });
+			bound = &range->arrays.back();
+		}
+		bound->minOffset = std::min(bound->minOffset, offset);
+		bound->maxOffset = std::max(bound->maxOffset, offset);
+
+		if (read != nullptr)
+			read->rangeSlot = bound->slot;
+		else
+			write->rangeSlot = bound->slot;
+	}
+
+	if (!range->arrays.empty())
+		loop.range = std::move(range);
+}
+
+void Optimizer::collectAccesses(Stmt* stmt, std::vector<Expr*>& accesses)
+{
+	if (stmt == nullptr)
+		return;
+
+	if (PrintStmt* print = dynamic_cast<PrintStmt*>(stmt))
+	{
+		collectAccesses(print->expr.get(), accesses);
+	}
+	else if (ExpressionStmt* expression = dynamic_cast<ExpressionStmt*>(stmt))
+	{
+		collectAccesses(expression->expr.get(), accesses);
+	}
+	else if (ByteStmt* byte = dynamic_cast<ByteStmt*>(stmt))
+	{
+		collectAccesses(byte->initializer.get(), accesses);
+	}
+	else if (ArrayStmt* array = dynamic_cast<ArrayStmt*>(stmt))
+	{
+		for (auto& element : array->elements)
+			collectAccesses(element.get(), accesses);
+		collectAccesses(array->count.get(), accesses);
+		collectAccesses(array->first.get(), accesses);
+		collectAccesses(array->last.get(), accesses);
+	}
+	else if (BlockStmt* block = dynamic_cast<BlockStmt*>(stmt))
+	{
+		for (auto& statement : block->stmts)
+			collectAccesses(statement.get(), accesses);
+	}
+	else if (IfStmt* ifStmt = dynamic_cast<IfStmt*>(stmt))
+	{
+		collectAccesses(ifStmt->condition.get(), accesses);
+		collectAccesses(ifStmt->thenBranch.get(), accesses);
+		collectAccesses(ifStmt->elseBranch.get(), accesses);
+	}
+	else if (WhileStmt* whileStmt = dynamic_cast<WhileStmt*>(stmt))
+	{
+		collectAccesses(whileStmt->condition.get(), accesses);
+		collectAccesses(whileStmt->body.get(), accesses);
+	}
+}
+
+void Optimizer::collectAccesses(Expr* expr, std::vector<Expr*>& accesses)
+{
+	if (expr == nullptr)
+		return;
+
+	if (UnaryExpr* unary = dynamic_cast<UnaryExpr*>(expr))
+	{
+		collectAccesses(unary->operand.get(), accesses);
+	}
+	else if (BinaryExpr* binary = dynamic_cast<BinaryExpr*>(expr))
+	{
+		collectAccesses(binary->left.get(), accesses);
+		collectAccesses(binary->right.get(), accesses);
+	}
+	else if (GroupingExpr* grouping = dynamic_cast<GroupingExpr*>(expr))
+	{
+		collectAccesses(grouping->expr.get(), accesses);
+	}
+	else if (AssignmentExpr* assignment = dynamic_cast<AssignmentExpr*>(expr))
+	{
+		collectAccesses(assignment->value.get(), accesses);
+	}
+	else if (ArrayPushExpr* push = dynamic_cast<ArrayPushExpr*>(expr))
+	{
+		collectAccesses(push->value.get(), accesses);
+	}
+	else if (ArrayAccessExpr* access = dynamic_cast<ArrayAccessExpr*>(expr))
+	{
+		accesses.push_back(access);
+		collectAccesses(access->index.get(), accesses);
+	}
+	else if (ArraySetExpr* set = dynamic_cast<ArraySetExpr*>(expr))
+	{
+		accesses.push_back(set);
+		collectAccesses(set->index.get(), accesses);
+		collectAccesses(set->value.get(), accesses);
+	}
+}
+
+//	copies side effect free expressions, returns nullptr for anything else
+std::unique_ptr<Expr> Optimizer::clonePure(const Expr* expr)
+{
+	if (const LiteralExpr* literal = dynamic_cast<const LiteralExpr*>(expr))
+		return std::make_unique<LiteralExpr>(literal->literal);
+
+	if (const VariableExpr* variable = dynamic_cast<const VariableExpr*>(expr))
+		return std::make_unique<VariableExpr>(variable->name);
+
+	if (const GroupingExpr* grouping = dynamic_cast<const GroupingExpr*>(expr))
+	{
+		auto inner = clonePure(grouping->expr.get());
+		return inner != nullptr ? std::make_unique<GroupingExpr>(std::move(inner)) : nullptr;
+	}
+
+	if (const UnaryExpr* unary = dynamic_cast<const UnaryExpr*>(expr))
+	{
+		auto operand = clonePure(unary->operand.get());
+		return operand != nullptr ? std::make_unique<UnaryExpr>(unary->op, std::move(operand)) : nullptr;
+	}
+
+	if (const BinaryExpr* binary = dynamic_cast<const BinaryExpr*>(expr))
+	{
+		auto left = clonePure(binary->left.get());
+		auto right = clonePure(binary->right.get());
+		if (left == nullptr || right == nullptr)
+			return nullptr;
+		return std::make_unique<BinaryExpr>(std::move(left), binary->op, std::move(right));
+	}
+
+	if (const ArrayAccessExpr* access = dynamic_cast<const ArrayAccessExpr*>(expr))
+	{
+		auto index = clonePure(access->index.get());
+		return index != nullptr ? std::make_unique<ArrayAccessExpr>(access->name, std::move(index)) : nullptr;
+	}
+
+	return nullptr;
+}
+
+//	moves pure expressions that read nothing the loop writes into the loop's
+//	hoisted list, they are evaluated once per loop entry instead of per iteration
+void Optimizer::hoistInvariants(WhileStmt& loop)
+{
+	Effects effects;
+	effects.addExpr(*loop.condition);
+	effects.addStmt(*loop.body);
+	effects.widen(views);
+	if (effects.opaque)
+		return;
+
+	hoistExpr(loop.condition, effects, loop);
+	hoistStmt(loop.body.get(), effects, loop);
+}
+
+void Optimizer::hoistStmt(Stmt* stmt, const Effects& loopEffects, WhileStmt& loop)
+{
+	if (PrintStmt* print = dynamic_cast<PrintStmt*>(stmt))
+	{
+		hoistExpr(print->expr, loopEffects, loop);
+	}
+	else if (ExpressionStmt* expression = dynamic_cast<ExpressionStmt*>(stmt))
+	{
+		hoistExpr(expression->expr, loopEffects, loop);
+	}
+	else if (ByteStmt* byte = dynamic_cast<ByteStmt*>(stmt))
+	{
+		if (byte->initializer != nullptr)
+			hoistExpr(byte->initializer, loopEffects, loop);
+	}
+	else if (ArrayStmt* array = dynamic_cast<ArrayStmt*>(stmt))
+	{
+		for (auto& element : array->elements)
+			hoistExpr(element, loopEffects, loop);
+		if (array->count != nullptr)
+			hoistExpr(array->count, loopEffects, loop);
+		if (array->first != nullptr)
+			hoistExpr(array->first, loopEffects, loop);
+		if (array->last != nullptr)
+			hoistExpr(array->last, loopEffects, loop);
+	}
+	else if (BlockStmt* block = dynamic_cast<BlockStmt*>(stmt))
+	{
+		for (auto& statement : block->stmts)
+			hoistStmt(statement.get(), loopEffects, loop);
+	}
+	else if (IfStmt* ifStmt = dynamic_cast<IfStmt*>(stmt))
+	{
+		hoistExpr(ifStmt->condition, loopEffects, loop);
+		hoistStmt(ifStmt->thenBranch.get(), loopEffects, loop);
+		if (ifStmt->elseBranch != nullptr)
+			hoistStmt(ifStmt->elseBranch.get(), loopEffects, loop);
+	}
+	else if (WhileStmt* whileStmt = dynamic_cast<WhileStmt*>(stmt))
+	{
+		hoistExpr(whileStmt->condition, loopEffects, loop);
+		hoistStmt(whileStmt->body.get(), loopEffects, loop);
+	}
+	else if (DeleteStmt* deleteStmt = dynamic_cast<DeleteStmt*>(stmt))
+	{
+		hoistExpr(deleteStmt->key, loopEffects, loop);
+	}
+}
+
+void Optimizer::hoistExpr(std::unique_ptr<Expr>& expr, const Effects& loopEffects, WhileStmt& loop)
+{
+	if (isComputation(expr.get()))
+	{
+		std::unique_ptr<Expr> copy = clonePure(expr.get());
+		bool invariant = copy != nullptr;
+		if (invariant)
+		{
+			Effects effects;
+			effects.addExpr(*copy);
+			for (const auto& name : effects.reads)
+				invariant = invariant && !loopEffects.mayChange(name);
+			for (const auto& name : effects.arrayReads)
+				invariant = invariant && !loopEffects.mayChangeArray(name);
+		}
+
+		if (invariant)
+		{
+			int slot = nextTempSlot++;
+			loop.hoisted.push_back({ slot, std::move(copy) });
+			expr = std::make_unique<TempExpr>(slot, std::move(expr));
+			return;
+		}
+	}
+
+	if (UnaryExpr* unary = dynamic_cast<UnaryExpr*>(expr.get()))
+	{
+		hoistExpr(unary->operand, loopEffects, loop);
+	}
+	else if (BinaryExpr* binary = dynamic_cast<BinaryExpr*>(expr.get()))
+	{
+		hoistExpr(binary->left, loopEffects, loop);
+		hoistExpr(binary->right, loopEffects, loop);
+	}
+	else if (GroupingExpr* grouping = dynamic_cast<GroupingExpr*>(expr.get()))
+	{
+		hoistExpr(grouping->expr, loopEffects, loop);
+	}
+	else if (AssignmentExpr* assignment = dynamic_cast<AssignmentExpr*>(expr.get()))
+	{
+		hoistExpr(assignment->value, loopEffects, loop);
+	}
+	else if (ArrayPushExpr* push = dynamic_cast<ArrayPushExpr*>(expr.get()))
+	{
+		hoistExpr(push->value, loopEffects, loop);
+	}
+	else if (ArrayAccessExpr* access = dynamic_cast<ArrayAccessExpr*>(expr.get()))
+	{
+		hoistExpr(access->index, loopEffects, loop);
+	}
+	else if (ArraySetExpr* set = dynamic_cast<ArraySetExpr*>(expr.get()))
+	{
+		hoistExpr(set->index, loopEffects, loop);
+		hoistExpr(set->value, loopEffects, loop);
+	}
+	else if (CallExpr* call = dynamic_cast<CallExpr*>(expr.get()))
+	{
+		for (auto& argument : call->arguments)
+			hoistExpr(argument, loopEffects, loop);
+	}
+	else if (MapAccessExpr* access = dynamic_cast<MapAccessExpr*>(expr.get()))
+	{
+		hoistExpr(access->key, loopEffects, loop);
+	}
+	else if (MapSetExpr* set = dynamic_cast<MapSetExpr*>(expr.get()))
+	{
+		hoistExpr(set->key, loopEffects, loop);
+		hoistExpr(set->value, loopEffects, loop);
+	}
+	else if (MapContainsExpr* contains = dynamic_cast<MapContainsExpr*>(expr.get()))
+	{
+		hoistExpr(contains->key, loopEffects, loop);
+	}
+}
+
+//	walks statements in execution order, expressions are replaced by a temp
+//	read when the same pure expression is still available
+void Optimizer::eliminateStmt(std::unique_ptr<Stmt>& stmt, std::vector<Available>& available)
+{
+	if (stmt == nullptr)
+		return;
+
+	if (PrintStmt* print = dynamic_cast<PrintStmt*>(stmt.get()))
+	{
+		eliminateExpr(print->expr, available);
+	}
+	else if (ExpressionStmt* expression = dynamic_cast<ExpressionStmt*>(stmt.get()))
+	{
+		eliminateExpr(expression->expr, available);
+	}
+	else if (ByteStmt* byte = dynamic_cast<ByteStmt*>(stmt.get()))
+	{
+		if (byte->initializer != nullptr)
+			eliminateExpr(byte->initializer, available);
+		killVariable(available, byte->name.lexeme);
+	}
+	else if (ArrayStmt* array = dynamic_cast<ArrayStmt*>(stmt.get()))
+	{
+		for (auto& element : array->elements)
+			eliminateExpr(element, available);
+		if (array->count != nullptr)
+			eliminateExpr(array->count, available);
+		if (array->first != nullptr)
+			eliminateExpr(array->first, available);
+		if (array->last != nullptr)
+			eliminateExpr(array->last, available);
+		killArray(available, array->name.lexeme, nullptr, -1);
+	}
+	else if (dynamic_cast<MapStmt*>(stmt.get()))
+	{
+		//	map reads are never available
+	}
+	else if (DeleteStmt* deleteStmt = dynamic_cast<DeleteStmt*>(stmt.get()))
+	{
+		eliminateExpr(deleteStmt->key, available);
+	}
+	else if (BlockStmt* block = dynamic_cast<BlockStmt*>(stmt.get()))
+	{
+		for (auto& statement : block->stmts)
+			eliminateStmt(statement, available);
+	}
+	else if (IfStmt* ifStmt = dynamic_cast<IfStmt*>(stmt.get()))
+	{
+		//	the condition dominates both branches, the branches only themselves
+		eliminateExpr(ifStmt->condition, available);
+
+		Effects effects;
+		std::vector<Available> thenAvailable = available;
+		eliminateStmt(ifStmt->thenBranch, thenAvailable);
+		effects.addStmt(*ifStmt->thenBranch);
+		if (ifStmt->elseBranch != nullptr)
+		{
+			std::vector<Available> elseAvailable = available;
+			eliminateStmt(ifStmt->elseBranch, elseAvailable);
+			effects.addStmt(*ifStmt->elseBranch);
+		}
+		effects.widen(views);
+		killEffects(available, effects);
+	}
+	else if (WhileStmt* whileStmt = dynamic_cast<WhileStmt*>(stmt.get()))
+	{
+		//	anything the loop writes is stale from the second iteration on
+		Effects effects;
+		effects.addExpr(*whileStmt->condition);
+		effects.addStmt(*whileStmt->body);
+		effects.widen(views);
+		killEffects(available, effects);
+
+		std::vector<Available> loopAvailable = available;
+		eliminateExpr(whileStmt->condition, loopAvailable);
+		eliminateStmt(whileStmt->body, loopAvailable);
+	}
+	else if (ParallelStmt* parallel = dynamic_cast<ParallelStmt*>(stmt.get()))
+	{
+		eliminateExpr(parallel->from, available);
+		eliminateExpr(parallel->to, available);
+		Effects effects;
+		effects.addStmt(*parallel);
+		effects.widen(views);
+		killEffects(available, effects);
+
+		//	chunks run on interpreters that don't have this one's temps, the
+		//	body starts a region of its own
+		std::vector<Available> bodyAvailable;
+		eliminateStmt(parallel->body, bodyAvailable);
+	}
+	else if (dynamic_cast<SubscribedStmt*>(stmt.get()))
+	{
+		//	doesn't run here, and where it does run nothing is known
+	}
+	else
+	{
+		//	includes evoke, any subscriber can run
+		available.clear();
+	}
+}
+
+void Optimizer::eliminateExpr(std::unique_ptr<Expr>& expr, std::vector<Available>& available)
+{
+	std::string key;
+	bool candidate = isComputation(expr.get()) && pureKey(expr.get(), key);
+	if (candidate)
+	{
+		for (auto& entry : available)
+		{
+			if (entry.key == key)
+			{
+				auto temp = std::make_unique<TempExpr>(captureSlot(entry), std::move(expr));
+				if (entry.needsRange)
+					temp->rangeSlot = entry.rangeSlot;
+				expr = std::move(temp);
+				return;
+			}
+		}
+	}
+
+	//	children in the order the interpreter evaluates them
+	if (UnaryExpr* unary = dynamic_cast<UnaryExpr*>(expr.get()))
+	{
+		eliminateExpr(unary->operand, available);
+	}
+	else if (BinaryExpr* binary = dynamic_cast<BinaryExpr*>(expr.get()))
+	{
+		eliminateExpr(binary->left, available);
+		eliminateExpr(binary->right, available);
+	}
+	else if (GroupingExpr* grouping = dynamic_cast<GroupingExpr*>(expr.get()))
+	{
+		eliminateExpr(grouping->expr, available);
+	}
+	else if (AssignmentExpr* assignment = dynamic_cast<AssignmentExpr*>(expr.get()))
+	{
+		eliminateExpr(assignment->value, available);
+		killVariable(available, assignment->name.lexeme);
+	}
+	else if (ArrayPushExpr* push = dynamic_cast<ArrayPushExpr*>(expr.get()))
+	{
+		//	pushing doesn't change existing elements
+		eliminateExpr(push->value, available);
+	}
+	else if (ArrayAccessExpr* access = dynamic_cast<ArrayAccessExpr*>(expr.get()))
+	{
+		eliminateExpr(access->index, available);
+	}
+	else if (ArraySetExpr* set = dynamic_cast<ArraySetExpr*>(expr.get()))
+	{
+		//	look at the index before it is replaced by a temp
+		std::unique_ptr<Expr> index = clonePure(set->index.get());
+		eliminateExpr(set->index, available);
+		eliminateExpr(set->value, available);
+		killArray(available, set->name.lexeme, index.get(), set->rangeSlot);
+	}
+	else if (CallExpr* call = dynamic_cast<CallExpr*>(expr.get()))
+	{
+		for (auto& argument : call->arguments)
+			eliminateExpr(argument, available);
+		if (builtinInfo(call->builtin).writes)
+			killArray(available, call->arrays[0].lexeme, nullptr, -1);
+	}
+	else if (MapAccessExpr* access = dynamic_cast<MapAccessExpr*>(expr.get()))
+	{
+		eliminateExpr(access->key, available);
+	}
+	else if (MapSetExpr* set = dynamic_cast<MapSetExpr*>(expr.get()))
+	{
+		eliminateExpr(set->key, available);
+		eliminateExpr(set->value, available);
+	}
+	else if (MapContainsExpr* contains = dynamic_cast<MapContainsExpr*>(expr.get()))
+	{
+		eliminateExpr(contains->key, available);
+	}
+	else if (IncrementExpr* increment = dynamic_cast<IncrementExpr*>(expr.get()))
+	{
+		killVariable(available, increment->name.lexeme);
+	}
+	else if (CompareAdjacentExpr* compare = dynamic_cast<CompareAdjacentExpr*>(expr.get()))
+	{
+		//	both elements become available, stored if a later read wants them
+		BinaryExpr* original = dynamic_cast<BinaryExpr*>(compare->original.get());
+		std::string leftKey, rightKey;
+		if (pureKey(original->left.get(), leftKey) && pureKey(original->right.get(), rightKey))
+		{
+			addAvailable(available, leftKey, *original->left);
+			available.back().site = nullptr;
+			available.back().fused = compare;
+			available.back().fusedLeft = true;
+			addAvailable(available, rightKey, *original->right);
+			available.back().site = nullptr;
+			available.back().fused = compare;
+			available.back().fusedLeft = false;
+		}
+	}
+
+	if (candidate)
+	{
+		addAvailable(available, key, *expr);
+		available.back().site = &expr;
+	}
+}
+
+void Optimizer::addAvailable(std::vector<Available>& available, const std::string& key, const Expr& expr)
+{
+	Available entry;
+	entry.key = key;
+	entry.effects.addExpr(expr);
+	//	a write to a view or its array then kills the reads of both
+	entry.effects.widen(views);
+	entry.site = nullptr;
+	entry.fused = nullptr;
+	entry.fusedLeft = false;
+	entry.offset = 0;
+	entry.rangeSlot = -1;
+	entry.needsRange = false;
+
+	Token index;
+	const ArrayAccessExpr* access = dynamic_cast<const ArrayAccessExpr*>(&expr);
+	entry.indexed = access != nullptr && isIndexOffset(access->index.get(), index, entry.offset);
+	if (entry.indexed)
+	{
+		entry.indexName = index.lexeme;
+		entry.rangeSlot = access->rangeSlot;
+	}
+
+	available.push_back(std::move(entry));
+}
+
+//	makes the first occurrence store its value, once per occurrence
+int Optimizer::captureSlot(Available& entry)
+{
+	const void* origin = entry.fused != nullptr ? (const void*)(entry.fusedLeft ? &entry.fused->leftSlot : &entry.fused->rightSlot)
+		: (const void*)entry.site;
+
+	auto it = captured.find(origin);
+	if (it != captured.end())
+		return it->second;
+
+	int slot = nextTempSlot++;
+	captured[origin] = slot;
+	if (entry.fused != nullptr)
+	{
+		if (entry.fusedLeft)
+			entry.fused->leftSlot = slot;
+		else
+			entry.fused->rightSlot = slot;
+	}
+	else
+	{
+		*entry.site = std::make_unique<CaptureExpr>(slot, std::move(*entry.site));
+	}
+	return slot;
+}
+
+void Optimizer::killVariable(std::vector<Available>& available, const std::string& name)
+{
+	for (size_t i = 0; i < available.size();)
+	{
+		if (available[i].effects.reads.count(name))
+			available.erase(available.begin() + i);
+		else
+			i++;
+	}
+}
+
+//	a write to array[j + a] can't change array[j + b] when a != b, as long as
+//	j is a whole number. that is only known while both accesses' loop range
+//	holds, so the reuse is made conditional on it
+void Optimizer::killArray(std::vector<Available>& available, const std::string& name, const Expr* index, int rangeSlot)
+{
+	Token writeIndex;
+	double writeOffset = 0;
+	bool indexed = index != nullptr && rangeSlot >= 0 && isIndexOffset(index, writeIndex, writeOffset);
+
+	for (size_t i = 0; i < available.size();)
+	{
+		Available& entry = available[i];
+		bool distinct = indexed && entry.indexed && entry.rangeSlot == rangeSlot
+			&& entry.indexName == writeIndex.lexeme && entry.offset != writeOffset
+			&& entry.effects.arrayReads.size() == 1;
+		if (entry.effects.arrayReads.count(name) && !distinct)
+		{
+			available.erase(available.begin() + i);
+			continue;
+		}
+		if (entry.effects.arrayReads.count(name))
+			entry.needsRange = true;
+		i++;
+	}
+}
+
+void Optimizer::killEffects(std::vector<Available>& available, const Effects& effects)
+{
+	if (effects.opaque)
+	{
+		available.clear();
+		return;
+	}
+	for (const auto& name : effects.writes)
+		killVariable(available, name);
+	for (const auto& name : effects.declares)
+		killVariable(available, name);
+	for (const auto& name : effects.arrayWrites)
+		killArray(available, name, nullptr, -1);
+	for (const auto& name : effects.arrayDeclares)
+		killArray(available, name, nullptr, -1);
+}
+
+bool Optimizer::isNumberLiteral(const Expr* expr, double& value)
+{
+	const LiteralExpr* literal = dynamic_cast<const LiteralExpr*>(expr);
+	if (literal == nullptr || literal->literal.type != NUMBER_LITERAL)
+		return false;
+	value = literal->literal.literal.getDouble();
+	return true;
+}
+
+//	structural key of a side effect free expression, equal keys evaluate to
+//	equal values as long as nothing they read was written in between
+bool Optimizer::pureKey(const Expr* expr, std::string& key)
+{
+	if (const LiteralExpr* literal = dynamic_cast<const LiteralExpr*>(expr))
+	{
+		key = "#" + std::to_string(literal->literal.type) + ":" + literal->literal.lexeme;
+		return true;
+	}
+	if (const VariableExpr* variable = dynamic_cast<const VariableExpr*>(expr))
+	{
+		key = "$" + variable->name.lexeme;
+		return true;
+	}
+	if (const TempExpr* temp = dynamic_cast<const TempExpr*>(expr))
+	{
+		key = "@" + std::to_string(temp->slot);
+		return true;
+	}
+	if (const GroupingExpr* grouping = dynamic_cast<const GroupingExpr*>(expr))
+	{
+		return pureKey(grouping->expr.get(), key);
+	}
+
+	std::string left, right;
+	if (const UnaryExpr* unary = dynamic_cast<const UnaryExpr*>(expr))
+	{
+		if (!pureKey(unary->operand.get(), right))
+			return false;
+		key = "(" + unary->op.lexeme + " " + right + ")";
+		return true;
+	}
+	if (const BinaryExpr* binary = dynamic_cast<const BinaryExpr*>(expr))
+	{
+		if (!pureKey(binary->left.get(), left) || !pureKey(binary->right.get(), right))
+			return false;
+		key = "(" + left + " " + binary->op.lexeme + " " + right + ")";
+		return true;
+	}
+	if (const ArrayAccessExpr* access = dynamic_cast<const ArrayAccessExpr*>(expr))
+	{
+		if (!pureKey(access->index.get(), right))
+			return false;
+		key = access->name.lexeme + "[" + right + "]";
+		return true;
+	}
+	return false;
+}
+
+//	expressions that cost more to recompute than to read back from a temp
+bool Optimizer::isComputation(const Expr* expr)
+{
+	while (const GroupingExpr* grouping = dynamic_cast<const GroupingExpr*>(expr))
+		expr = grouping->expr.get();
+
+	return dynamic_cast<const UnaryExpr*>(expr) != nullptr
+		|| dynamic_cast<const BinaryExpr*>(expr) != nullptr
+		|| dynamic_cast<const ArrayAccessExpr*>(expr) != nullptr;
+}
+
+bool Optimizer::isRelational(TokenType type)
+{
+	return type == GREATER || type == GREATER_EQUAL || type == LESS || type == LESS_EQUAL;
+}
+
+//	matches j, j + constant and j - constant
+bool Optimizer::isIndexOffset(const Expr* expr, Token& index, double& offset)
+{
+	if (const VariableExpr* variable = dynamic_cast<const VariableExpr*>(expr))
+	{
+		index = variable->name;
+		offset = 0;
+		return true;
+	}
+
+	const BinaryExpr* binary = dynamic_cast<const BinaryExpr*>(expr);
+	if (binary == nullptr || (binary->op.type != PLUS && binary->op.type != MINUS))
+		return false;
+
+	const VariableExpr* variable = dynamic_cast<const VariableExpr*>(binary->left.get());
+	if (variable == nullptr || !isNumberLiteral(binary->right.get(), offset))
+		return false;
+
+	index = variable->name;
+	if (binary->op.type == MINUS)
+		offset = -offset;
+	return true;
+}
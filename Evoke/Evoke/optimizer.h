@@ -0,0 +1,81 @@
+#pragma once
+#include <vector>
+#include <memory>
+#include <map>
+#include <set>
+#include <string>
+#include "expr.h"
+#include "stmt.h"
+#include "effects.h"
+
+//	rewrites the parsed program before it is interpreted
+//	every rewrite must keep the observable behaviour (output and errors) identical
+class Optimizer
+{
+public:
+	//	views are the arrays the parser saw declared as views or taken views of
+	void optimize(std::vector<std::unique_ptr<Stmt>>& statements, const std::set<std::string>& views);
+
+private:
+	void optimizeStmt(std::unique_ptr<Stmt>& stmt);
+	void optimizeExpr(std::unique_ptr<Expr>& expr);
+
+	//	superinstructions
+	std::unique_ptr<Expr> fuseIncrement(std::unique_ptr<Expr>& expr);
+	std::unique_ptr<Expr> fuseCompareLocal(std::unique_ptr<Expr>& expr);
+	std::unique_ptr<Expr> fuseCompareAdjacent(std::unique_ptr<Expr>& expr);
+
+	//	bounds check elimination
+	void analyzeRange(WhileStmt& loop);
+	void collectAccesses(Stmt* stmt, std::vector<Expr*>& accesses);
+	void collectAccesses(Expr* expr, std::vector<Expr*>& accesses);
+	static std::unique_ptr<Expr> clonePure(const Expr* expr);
+
+	//	loop invariant code motion
+	void hoistInvariants(WhileStmt& loop);
+	void hoistStmt(Stmt* stmt, const Effects& loopEffects, WhileStmt& loop);
+	void hoistExpr(std::unique_ptr<Expr>& expr, const Effects& loopEffects, WhileStmt& loop);
+
+	//	common subexpression elimination
+	//	an available expression is a pure expression already evaluated on every
+	//	path to the current point, with nothing written since that it reads
+	struct Available
+	{
+		std::string key;
+		Effects effects;
+		//	first occurrence, wrapped in a CaptureExpr once it is reused
+		std::unique_ptr<Expr>* site;
+		//	or one side of a fused comparison
+		CompareAdjacentExpr* fused;
+		bool fusedLeft;
+		//	array[index + offset], used to tell apart writes that can't alias
+		bool indexed;
+		std::string indexName;
+		double offset;
+		//	range slot of the access, a proven range keeps the index whole
+		int rangeSlot;
+		//	survived a write that only can't alias while the range holds
+		bool needsRange;
+	};
+
+	void eliminateStmt(std::unique_ptr<Stmt>& stmt, std::vector<Available>& available);
+	void eliminateExpr(std::unique_ptr<Expr>& expr, std::vector<Available>& available);
+	void addAvailable(std::vector<Available>& available, const std::string& key, const Expr& expr);
+	int captureSlot(Available& entry);
+	static void killVariable(std::vector<Available>& available, const std::string& name);
+	static void killArray(std::vector<Available>& available, const std::string& name, const Expr* index, int rangeSlot);
+	static void killEffects(std::vector<Available>& available, const Effects& effects);
+
+	//	pattern helpers
+	static bool isNumberLiteral(const Expr* expr, double& value);
+	static bool isRelational(TokenType type);
+	static bool isIndexOffset(const Expr* expr, Token& index, double& offset);
+	static bool pureKey(const Expr* expr, std::string& key);
+	static bool isComputation(const Expr* expr);
+
+	int nextRangeSlot = 0;
+	int nextTempSlot = 0;
+	//	slot each reused first occurrence was captured into
+	std::map<const void*, int> captured;
+	std::set<std::string> views;
+};
@@ -0,0 +1,33 @@
+#pragma once
+#include <string>
+#include <optional>
+#include <vector>
+#include "output.h"
+
+//	command line switches, parsed in main and handed to Vous
+struct Options
+{
+	//	run the optimizer over the parsed program
+	bool optimize = true;
+	//	print dispatch counts and timings to stderr after each run
+	bool stats = false;
+	//	threads that run independent event subscribers, 1 runs them in order
+	unsigned threads = 1;
+	//	skip event subscribers whose inputs haven't changed since they last ran
+	bool reactive = false;
+	//	file that receives what the script prints, standard output if empty
+	std::string output;
+	//	when buffered output is written out, by default on every line on a
+	//	terminal and in blocks otherwise
+	std::optional<Output::Flush> flush;
+	size_t flushBytes = Output::bufferSize;
+	//	run the script once per line of the inputs, with the line in `record`
+	bool batch = false;
+	std::vector<std::string> inputs;
+	//	serve scripts on this unix domain socket instead of running one
+	std::string serve;
+	//	run the script on the server listening on this socket
+	std::string connect;
+	//	print the event graph in graphviz format instead of running
+	bool dot = false;
+};
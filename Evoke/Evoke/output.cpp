@@ -0,0 +1,133 @@
+#include "output.h"
+#include <cerrno>
+#include <algorithm>
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#else
+#include <unistd.h>
+#include <fcntl.h>
+#endif
+
+Output::Output() : buffer(bufferSize), fd(1)
+{
+#ifdef _WIN32
+	policy = _isatty(fd) ? Flush::LINE : Flush::SIZE;
+#else
+	policy = isatty(fd) ? Flush::LINE : Flush::SIZE;
+#endif
+}
+
+Output::Output(std::string& sink) : buffer(bufferSize), fd(-1), sink(&sink), policy(Flush::EXIT)
+{
+}
+
+Output::~Output()
+{
+	flush();
+	if (owned)
+	{
+#ifdef _WIN32
+		_close(fd);
+#else
+		close(fd);
+#endif
+	}
+}
+
+bool Output::open(const std::string& path)
+{
+#ifdef _WIN32
+	int file = _open(path.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+	int file = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+#endif
+	if (file < 0)
+		return false;
+
+	flush();
+	if (owned)
+	{
+#ifdef _WIN32
+		_close(fd);
+#else
+		close(fd);
+#endif
+	}
+	fd = file;
+	owned = true;
+	if (policy == Flush::LINE)
+		policy = Flush::SIZE;
+	return true;
+}
+
+void Output::setFlush(Flush policy, size_t threshold)
+{
+	this->policy = policy;
+	this->threshold = std::max<size_t>(1, std::min(threshold, bufferSize));
+}
+
+//	data too big for the buffer skips it once the buffer is empty
+void Output::write(const char* data, size_t size)
+{
+	if (used + size > buffer.size())
+	{
+		flush();
+		if (size > buffer.size())
+		{
+			drain(data, size);
+			return;
+		}
+	}
+
+	std::copy(data, data + size, buffer.data() + used);
+	used += size;
+	if (policy == Flush::LINE ? std::find(data, data + size, '\n') != data + size
+		: policy == Flush::SIZE && used >= threshold)
+		flush();
+}
+
+void Output::put(char c)
+{
+	if (used == buffer.size())
+		flush();
+
+	buffer[used++] = c;
+	if (policy == Flush::LINE ? c == '\n' : policy == Flush::SIZE && used >= threshold)
+		flush();
+}
+
+void Output::flush()
+{
+	drain(buffer.data(), used);
+	used = 0;
+}
+
+//	write can take less than asked for or be interrupted, loops until done
+//	a failing descriptor drops the rest, there is nowhere to report it
+void Output::drain(const char* data, size_t size)
+{
+	if (sink != nullptr)
+	{
+		sink->append(data, size);
+		return;
+	}
+
+	while (size > 0)
+	{
+#ifdef _WIN32
+		int written = _write(fd, data, static_cast<unsigned>(std::min<size_t>(size, 1 << 30)));
+#else
+		ssize_t written = ::write(fd, data, size);
+#endif
+		if (written < 0)
+		{
+			if (errno == EINTR)
+				continue;
+			return;
+		}
+		data += written;
+		size -= written;
+	}
+}
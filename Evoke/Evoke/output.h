@@ -0,0 +1,50 @@
+#pragma once
+#include <string>
+#include <vector>
+
+//	buffered sink for program output, written straight to a file descriptor
+//	with write(2) (_write on windows) instead of going through iostreams
+class Output
+{
+public:
+	enum class Flush
+	{
+		//	only when the buffer is full and when the program ends
+		EXIT,
+		//	after every newline, the default on a terminal
+		LINE,
+		//	whenever threshold bytes are waiting
+		SIZE,
+	};
+
+	static constexpr size_t bufferSize = 1 << 16;
+
+	//	standard output, line flushed on a terminal and block flushed otherwise
+	Output();
+	//	collects everything in sink instead of writing it out
+	explicit Output(std::string& sink);
+	~Output();
+	Output(const Output&) = delete;
+	Output& operator=(const Output&) = delete;
+
+	//	sends everything after this to a new file, false if it can't be created
+	bool open(const std::string& path);
+	void setFlush(Flush policy, size_t threshold = bufferSize);
+	bool lineFlushed() const { return policy == Flush::LINE; }
+
+	void write(const char* data, size_t size);
+	void write(const std::string& text) { write(text.data(), text.size()); }
+	void put(char c);
+	void flush();
+
+private:
+	void drain(const char* data, size_t size);
+
+	std::vector<char> buffer;
+	size_t used = 0;
+	int fd;
+	bool owned = false;
+	std::string* sink = nullptr;
+	Flush policy;
+	size_t threshold = bufferSize;
+};
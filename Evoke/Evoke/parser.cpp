@@ -1,43 +1,179 @@
 #include "parser.h"
-#include "vous.h"
+#include "deep.h"
+#include "effects.h"
+#include <algorithm>
 
-Parser::Parser(std::vector<Token> tokens) : tokens(std::move(tokens)), current(0) {}
+Parser::Parser(std::vector<Token> tokens, Context& context) : tokens(std::move(tokens)), context(context), current(0) {}
 
 std::vector<std::unique_ptr<Stmt>> Parser::parse()
 {
-	std::vector<std::unique_ptr<Stmt>> statements;
-	try {
-		while (!isAtEnd())
+	//	the bottom frame is the program itself, closed by the end of input
+	frames.clear();
+	frames.push_back(StmtFrame{ StmtFrame::BLOCK });
+	while (true)
+	{
+		try {
+			if (frames.back().kind == StmtFrame::BLOCK)
+			{
+				if (frames.size() == 1)
+				{
+					if (isAtEnd())
+						break;
+				}
+				else if (check(RIGHT_BRACE) || isAtEnd())
+				{
+					closeBlock();
+					continue;
+				}
+			}
+
+			std::unique_ptr<Stmt> stmt = statement(frames.back().kind == StmtFrame::BLOCK);
+			if (stmt != nullptr)
+				deliver(std::move(stmt), 1);
+		}
+		catch (ParseError& error)
 		{
-			statements.push_back(declaration());
+			recover(error);
 		}
 	}
-	catch (ParseError& error)
-	{
-		Vous::error(error.token, error.message);
-	}
+
+	std::vector<std::unique_ptr<Stmt>> statements = std::move(frames.back().stmts);
+	frames.clear();
 	return statements;
 }
 
-
-std::unique_ptr<Stmt> Parser::declaration()
+//	parses one statement, simple statements come back whole while blocks and
+//	compound statements push a frame and return nullptr
+//	declarations are only allowed directly inside a block
+std::unique_ptr<Stmt> Parser::statement(bool declaration)
 {
-	try {
-		if (match({ VAR }))
+	topLevel = frames.size() == 1;
+	if (declaration && match({ VAR }))
+	{
+		if (match({ ARRAY }))
+			return arrDeclaration();
+		else if (match({ LEFT_BRACE }))
 		{
-			if (match({ ARRAY }))
-				return arrDeclaration();
-			else
-				return varDeclaration();
+			consume(RIGHT_BRACE, "Expect '}' after '{' in map declaration.");
+			return mapDeclaration();
 		}
-		return statement();
+		else
+			return varDeclaration();
 	}
-	catch (ParseError error)
+
+	if (match({ FOR }))
+	{
+		forStatement();
+		return nullptr;
+	}
+	if (match({ PARALLEL }))
+	{
+		parallelStatement();
+		return nullptr;
+	}
+	if (match({ IF }))
+	{
+		ifStatement();
+		return nullptr;
+	}
+	if (match({ PRINT })) return printStatement();
+	if (match({ DELETE })) return deleteStatement();
+	if (match({ EVOKE, POST })) return evokeStatement(previous().type == POST);
+	if (match({ WHILE }))
 	{
-		Vous::error(error.token, error.message);
-		synchronize();
+		whileStatement();
 		return nullptr;
 	}
+	if (match({ LEFT_BRACE }))
+	{
+		frames.push_back(StmtFrame{ StmtFrame::BLOCK });
+		return nullptr;
+	}
+
+	return expressionStatement();
+}
+
+//	hands a finished statement to the frame waiting for it, completing
+//	compound statements as their bodies arrive
+void Parser::deliver(std::unique_ptr<Stmt> stmt, int depth)
+{
+	while (true)
+	{
+		StmtFrame& frame = frames.back();
+		frame.depth = std::max(frame.depth, depth);
+		int levels = 1;
+		switch (frame.kind)
+		{
+		case StmtFrame::BLOCK:
+			if (frames.size() == 1 && depth > maxRecursiveDepth)
+				stmt = std::make_unique<DeepStmt>(std::move(stmt));
+			frame.stmts.push_back(std::move(stmt));
+			return;
+		case StmtFrame::IF_THEN:
+			if (match({ ELSE }))
+			{
+				frame.thenBranch = std::move(stmt);
+				frame.kind = StmtFrame::IF_ELSE;
+				return;
+			}
+			stmt = std::make_unique<IfStmt>(std::move(frame.condition), std::move(stmt), nullptr);
+			break;
+		case StmtFrame::IF_ELSE:
+			stmt = std::make_unique<IfStmt>(std::move(frame.condition), std::move(frame.thenBranch), std::move(stmt));
+			break;
+		case StmtFrame::WHILE:
+			stmt = std::make_unique<WhileStmt>(std::move(frame.condition), std::move(stmt));
+			break;
+		case StmtFrame::FOR:
+			stmt = forLoop(frame, std::move(stmt));
+			levels = 3;
+			break;
+		case StmtFrame::PARALLEL:
+			stmt = parallelLoop(frame, std::move(stmt));
+			break;
+		}
+		depth = frame.depth + levels;
+		frames.pop_back();
+	}
+}
+
+void Parser::closeBlock()
+{
+	if (!check(RIGHT_BRACE))
+	{
+		//	the unterminated block is dropped, the error belongs to the statement
+		//	in the enclosing block that opened it
+		ParseError error(peek(), "Expect '}' after block.");
+		popFrame();
+		throw error;
+	}
+
+	advance();
+	std::vector<std::unique_ptr<Stmt>> statements = std::move(frames.back().stmts);
+	int depth = frames.back().depth;
+	frames.pop_back();
+	deliver(std::make_unique<BlockStmt>(std::move(statements)), depth + 1);
+}
+
+//	an error abandons the statement being parsed together with the compound
+//	statements around it, up to the block it belongs to
+void Parser::recover(const ParseError& error)
+{
+	context.error(error.token, error.message);
+	while (frames.back().kind != StmtFrame::BLOCK)
+		popFrame();
+	synchronize();
+	frames.back().stmts.push_back(nullptr);
+}
+
+void Parser::popFrame()
+{
+	StmtFrame frame = std::move(frames.back());
+	frames.pop_back();
+	for (auto& stmt : frame.stmts)
+		dismantle(std::move(stmt));
+	dismantle(std::move(frame.thenBranch));
+	dismantle(std::move(frame.initializer));
 }
 
 std::unique_ptr<Stmt> Parser::varDeclaration()
@@ -50,137 +186,334 @@ std::unique_ptr<Stmt> Parser::varDeclaration()
 		initializer = expression();
 	}
 
+	std::unique_ptr<Stmt> stmt = subscription(std::make_unique<ByteStmt>(name, std::move(initializer)));
 	consume(SEMICOLON, "Expect ';' after variable declaration");
 
-	return std::make_unique<ByteStmt>(name, std::move(initializer));
+	return stmt;
 }
 
 std::unique_ptr<Stmt> Parser::arrDeclaration()
 {
 	Token name = consume(IDENTIFIER, "Expect array name.");
+	auto array = std::make_unique<ArrayStmt>(name);
+	if (match({ EQUAL }))
+	{
+		if (match({ IDENTIFIER }))
+			arraySlice(*array);
+		//	'[]' scans as one token, the empty list is the same as no initializer
+		else if (!match({ ARRAY }))
+			arrayElements(*array);
+	}
+	std::unique_ptr<Stmt> stmt = subscription(std::move(array));
 	consume(SEMICOLON, "Expect ';' after variable declaration");
-	return std::make_unique<ArrayStmt>(name);
+	return stmt;
 }
 
-std::unique_ptr<Stmt> Parser::statement()
+//	[a, b, c] or [value; count]
+void Parser::arrayElements(ArrayStmt& array)
 {
-	if (match({ FOR })) return forStatement();
-	if (match({ IF })) return ifStatement();
-	if (match({ PRINT })) return printStatement();
-	if (match({ WHILE })) return whileStatement();
-	if (match({ LEFT_BRACE })) return blockStatement();
+	consume(LEFT_BRACKET, "Expect '[' before array elements.");
+	if (!check(RIGHT_BRACKET))
+	{
+		array.elements.push_back(expression());
+		if (match({ SEMICOLON }))
+			array.count = expression();
+		else
+		{
+			while (match({ COMMA }))
+				array.elements.push_back(expression());
+		}
+	}
+	consume(RIGHT_BRACKET, "Expect ']' after array elements.");
+	if (array.count == nullptr)
+	{
+		array.constant = constantArray(array.elements);
+		//	the literals live on in the built array
+		if (array.constant != nullptr)
+			array.elements.clear();
+	}
+}
 
-	return expressionStatement();
+//	source[first:last], the source name has been matched
+void Parser::arraySlice(ArrayStmt& array)
+{
+	array.slice = true;
+	array.source = previous();
+	consume(LEFT_BRACKET, "Expect '[' after array name in a slice.");
+	if (!check(COLON))
+		array.first = expression();
+	consume(COLON, "Expect ':' between the bounds of a slice.");
+	if (!check(RIGHT_BRACKET))
+		array.last = expression();
+	consume(RIGHT_BRACKET, "Expect ']' after slice.");
+	viewNames.insert(array.name.lexeme);
+	viewNames.insert(array.source.lexeme);
+}
+
+//	the elements as an array if each one is a number, string or boolean
+//	literal, a negated number counts too. nullptr otherwise
+std::unique_ptr<Array> Parser::constantArray(const std::vector<std::unique_ptr<Expr>>& elements)
+{
+	auto array = std::make_unique<Array>();
+	array->reserve(elements.size());
+	for (const auto& element : elements)
+	{
+		const Expr* expr = element.get();
+		bool negate = false;
+		if (const UnaryExpr* unary = dynamic_cast<const UnaryExpr*>(expr))
+		{
+			if (unary->op.type != MINUS)
+				return nullptr;
+			negate = true;
+			expr = unary->operand.get();
+		}
+		const LiteralExpr* literal = dynamic_cast<const LiteralExpr*>(expr);
+		if (literal == nullptr)
+			return nullptr;
+		const Value& value = literal->literal.literal;
+		if (!negate)
+			array->push(value);
+		else if (value.getType() == Type::INTEGER)
+			array->push(Value(-value.getInteger()));
+		else if (value.getType() == Type::DOUBLE)
+			array->push(Value(-value.getDouble()));
+		else
+			return nullptr;
+	}
+	return array;
+}
+
+std::unique_ptr<Stmt> Parser::mapDeclaration()
+{
+	Token name = consume(IDENTIFIER, "Expect map name.");
+	std::unique_ptr<Stmt> stmt = subscription(std::make_unique<MapStmt>(name));
+	consume(SEMICOLON, "Expect ';' after variable declaration");
+	return stmt;
+}
+
+std::unique_ptr<Stmt> Parser::deleteStatement()
+{
+	Token name = consume(IDENTIFIER, "Expect map name after 'delete'.");
+	consume(LEFT_BRACE, "Expect '{' after map name.");
+	std::unique_ptr<Expr> key = expression();
+	consume(RIGHT_BRACE, "Expect '}' after map key.");
+	std::unique_ptr<Stmt> stmt = subscription(std::make_unique<DeleteStmt>(name, std::move(key)));
+	consume(SEMICOLON, "Expect ';' after delete.");
+	return stmt;
 }
 
 std::unique_ptr<Stmt> Parser::printStatement()
 {
 	std::unique_ptr<Expr> value = expression();
+	std::unique_ptr<Stmt> stmt = subscription(std::make_unique<PrintStmt>(std::move(value)));
 	consume(SEMICOLON, "Expect ';' after value.");
-	return std::make_unique<PrintStmt>(std::move(value));
+	return stmt;
 }
 
 std::unique_ptr<Stmt> Parser::expressionStatement()
 {
 	std::unique_ptr<Expr> expr = expression();
+	std::unique_ptr<Stmt> stmt = subscription(std::make_unique<ExpressionStmt>(std::move(expr)));
 	consume(SEMICOLON, "Expect ';' after expression.");
-	return std::make_unique<ExpressionStmt>(std::move(expr));
+	return stmt;
+}
+
+std::unique_ptr<Stmt> Parser::evokeStatement(bool deferred)
+{
+	Token name = consume(IDENTIFIER, deferred ? "Expect event name after 'post'." : "Expect event name after 'evoke'.");
+
+	std::unique_ptr<Expr> condition = nullptr;
+	bool repeat = false;
+	if (match({ QUESTION, QUESTION_QUESTION }))
+	{
+		repeat = previous().type == QUESTION_QUESTION;
+		condition = expression();
+	}
+
+	std::unique_ptr<Stmt> stmt = subscription(std::make_unique<EvokeStmt>(name, eventId(name.lexeme), std::move(condition), repeat, deferred));
+	consume(SEMICOLON, "Expect ';' after evoke.");
+	return stmt;
 }
 
-std::unique_ptr<Stmt> Parser::blockStatement()
+//	`: EventName` before the ';' turns the statement into a subscriber of the event
+std::unique_ptr<Stmt> Parser::subscription(std::unique_ptr<Stmt> stmt)
 {
-	std::vector<std::unique_ptr<Stmt>> statements;
-	while (!check(RIGHT_BRACE) && !isAtEnd())
+	if (!match({ COLON }))
+		return stmt;
+
+	Token colon = previous();
+	Token event = consume(IDENTIFIER, "Expect event name after ':'.");
+	if (!topLevel)
 	{
-		statements.push_back(std::move(declaration()));
+		context.error(colon, "Only top level statements can subscribe to an event.");
+		return stmt;
 	}
+	return std::make_unique<SubscribedStmt>(event, eventId(event.lexeme), std::move(stmt));
+}
 
-	consume(RIGHT_BRACE, "Expect '}' after block.");
-	return std::make_unique<BlockStmt>(std::move(statements));
+//	event names are interned once while parsing, everything after works on ids
+int Parser::eventId(const std::string& name)
+{
+	auto it = eventIds.find(name);
+	if (it != eventIds.end())
+		return it->second;
+
+	int id = static_cast<int>(eventNames.size());
+	eventIds.emplace(name, id);
+	eventNames.push_back(name);
+	return id;
 }
 
-std::unique_ptr<Stmt> Parser::ifStatement()
+void Parser::ifStatement()
 {
 	consume(LEFT_PAREN, "Expect '(' after 'if'");
 	std::unique_ptr<Expr> condition = expression();
 	consume(RIGHT_PAREN, "Expect ')' after if condition");
 
-	std::unique_ptr<Stmt> thenBranch = statement();
-	std::unique_ptr<Stmt> elseBranch = nullptr;
-	if (match({ ELSE }))
-		elseBranch = statement();
-
-	return std::make_unique<IfStmt>(std::move(condition), std::move(thenBranch), std::move(elseBranch));
+	StmtFrame frame{ StmtFrame::IF_THEN };
+	frame.condition = std::move(condition);
+	frames.push_back(std::move(frame));
 }
 
-std::unique_ptr<Stmt> Parser::whileStatement()
+void Parser::whileStatement()
 {
 	consume(LEFT_PAREN, "Expect '(' after 'while'.");
 	std::unique_ptr<Expr> condition = expression();
 	consume(RIGHT_PAREN, "Expect ')' after while condition");
-	std::unique_ptr<Stmt> body = statement();
 
-	return std::make_unique<WhileStmt>(std::move(condition), std::move(body));
+	StmtFrame frame{ StmtFrame::WHILE };
+	frame.condition = std::move(condition);
+	frames.push_back(std::move(frame));
 }
 
-std::unique_ptr<Stmt> Parser::forStatement()
+void Parser::forStatement()
 {
 	consume(LEFT_PAREN, "Expect '(' after 'for'.");
-	std::unique_ptr<Stmt> initializer;
+	StmtFrame frame{ StmtFrame::FOR };
+	topLevel = false;
 
 	//	parse initializer
 	if (match({ SEMICOLON }))
 	{
-		initializer = nullptr;
+		frame.initializer = nullptr;
 	}
 	else if (match({ VAR }))
 	{
-		initializer = varDeclaration();
+		frame.initializer = varDeclaration();
 	}
 	else
 	{
-		initializer = expressionStatement();
+		frame.initializer = expressionStatement();
 	}
 
 	//	parse condition
-	std::unique_ptr<Expr> condition = nullptr;
 	if (!check(SEMICOLON))
 	{
-		condition = expression();
+		frame.condition = expression();
 	}
 	consume(SEMICOLON, "Expect ';' after loop condition.");
 
 	//	parse clause
-	std::unique_ptr<Expr> increment = nullptr;
 	if (!check(RIGHT_PAREN))
 	{
-		increment = expression();
+		frame.increment = expression();
 	}
 	consume(RIGHT_PAREN, "Expect ')' after for clauses");
 
-	std::unique_ptr<Stmt> body = statement();
+	frames.push_back(std::move(frame));
+}
+
+//	parallel [( op name, ... )] for (...), the for clauses are parsed as usual
+//	and checked once the body is there
+void Parser::parallelStatement()
+{
+	Token keyword = previous();
+	std::vector<ParallelStmt::Reduction> reductions;
+	if (match({ LEFT_PAREN }))
+	{
+		do
+		{
+			Token op = advance();
+			if (op.type != PLUS && op.type != STAR && !(op.type == IDENTIFIER && (op.lexeme == "min" || op.lexeme == "max")))
+				throw ParseError(op, "Expect '+', '*', 'min' or 'max' before a reduction.");
+			Token name = consume(IDENTIFIER, "Expect reduction variable name.");
+			reductions.push_back({ op, name });
+		} while (match({ COMMA }));
+		consume(RIGHT_PAREN, "Expect ')' after reductions.");
+	}
+	consume(FOR, "Expect 'for' after 'parallel'.");
+
+	forStatement();
+	frames.back().kind = StmtFrame::PARALLEL;
+	frames.back().keyword = keyword;
+	frames.back().reductions = std::move(reductions);
+}
+
+//	the loop has to count an index up by one through a range, and its
+//	iterations have to be independent. a loop that doesn't qualify is
+//	reported and left as a plain for loop
+std::unique_ptr<Stmt> Parser::parallelLoop(StmtFrame& frame, std::unique_ptr<Stmt> body)
+{
+	auto isIndex = [](const std::unique_ptr<Expr>& expr, const Token& index)
+	{
+		const VariableExpr* variable = dynamic_cast<const VariableExpr*>(expr.get());
+		return variable != nullptr && variable->name.lexeme == index.lexeme;
+	};
+
+	ByteStmt* start = dynamic_cast<ByteStmt*>(frame.initializer.get());
+	BinaryExpr* limit = dynamic_cast<BinaryExpr*>(frame.condition.get());
+	AssignmentExpr* step = dynamic_cast<AssignmentExpr*>(frame.increment.get());
+	BinaryExpr* next = step != nullptr ? dynamic_cast<BinaryExpr*>(step->value.get()) : nullptr;
+	const LiteralExpr* one = next != nullptr ? dynamic_cast<const LiteralExpr*>(next->right.get()) : nullptr;
+	bool counted = start != nullptr && start->initializer != nullptr
+		&& limit != nullptr && (limit->op.type == LESS || limit->op.type == LESS_EQUAL) && isIndex(limit->left, start->name)
+		&& step != nullptr && step->name.lexeme == start->name.lexeme
+		&& next != nullptr && next->op.type == PLUS && isIndex(next->left, start->name)
+		&& one != nullptr && one->literal.type == NUMBER_LITERAL && one->literal.literal.getDouble() == 1;
+	if (!counted)
+	{
+		context.error(frame.keyword, "A parallel loop has to count 'var i = from; i < to; i = i + 1'.");
+		return forLoop(frame, std::move(body));
+	}
 
-	if (increment != nullptr)
+	IterationCheck check(start->name, frame.reductions);
+	if (!check.check(*body))
+	{
+		context.error(check.token, check.message);
+		return forLoop(frame, std::move(body));
+	}
+
+	auto parallel = std::make_unique<ParallelStmt>(start->name, std::move(start->initializer), std::move(limit->right),
+		limit->op.type == LESS_EQUAL, std::move(frame.reductions), std::move(body));
+	parallel->sharedWrites.assign(check.sharedWrites().begin(), check.sharedWrites().end());
+	return parallel;
+}
+
+//	desugars a for loop into a while loop once its body is parsed
+std::unique_ptr<Stmt> Parser::forLoop(StmtFrame& frame, std::unique_ptr<Stmt> body)
+{
+	if (frame.increment != nullptr)
 	{
 		//	construct list with body and increment as separate statements
 		//	and set the loop body to be that new list
 		std::vector<std::unique_ptr<Stmt>> statements;
 		statements.push_back(std::move(body));
-		statements.push_back(std::make_unique<ExpressionStmt>(std::move(increment)));
+		statements.push_back(std::make_unique<ExpressionStmt>(std::move(frame.increment)));
 		body = std::make_unique<BlockStmt>(std::move(statements));
 	}
 
+	std::unique_ptr<Expr> condition = std::move(frame.condition);
 	if (condition == nullptr) {
 		condition = std::make_unique<LiteralExpr>(Token(TRUE, "true", Value(true), previous().line));
 	}
 
 	body = std::make_unique<WhileStmt>(std::move(condition), std::move(body));
 
-	if (initializer != nullptr) {
+	if (frame.initializer != nullptr) {
 		//	construct list with body and initializer as separate statements
 		//	and set the loop body to be that new list
 		std::vector<std::unique_ptr<Stmt>> statements;
-		statements.push_back(std::move(initializer));
+		statements.push_back(std::move(frame.initializer));
 		statements.push_back(std::move(body));
 		body = std::make_unique<BlockStmt>(std::move(statements));
 	}
@@ -188,161 +521,279 @@ std::unique_ptr<Stmt> Parser::forStatement()
 	return body;
 }
 
+//	operator precedence parsing, prefix operators and open brackets wait on
+//	the operator stack so nesting depth is only limited by memory
 std::unique_ptr<Expr> Parser::expression()
 {
-	return assignment();
-}
-
-std::unique_ptr<Expr> Parser::assignment()
-{
-	std::unique_ptr<Expr> expr = logical();
-
-	if (match({ ARROW }))
-	{
-		Token arrow = previous();
-		std::unique_ptr<Expr> value = assignment();
-		if (VariableExpr* variable = dynamic_cast<VariableExpr*>(expr.get()))
+	std::vector<Operand> operands;
+	std::vector<Operator> operators;
+	//	calls waiting for their arguments, one per CALL operator
+	std::vector<Operand> calls;
+	try {
+		while (true)
 		{
-			Token name = variable->name;
-			return std::make_unique<ArrayPushExpr>(name, std::move(value));
+			//	prefix operators and opening brackets, then one primary
+			while (match({ MINUS, BANG, LEFT_PAREN }))
+			{
+				Token token = previous();
+				operators.push_back({ token.type == LEFT_PAREN ? Operator::GROUP : Operator::UNARY, token, 0 });
+			}
+
+			if (match({ NUMBER_LITERAL, STRING_LITERAL, TRUE, FALSE }))
+			{
+				operands.push_back({ std::make_unique<LiteralExpr>(previous()), 1 });
+			}
+			else if (match({ IDENTIFIER }))
+			{
+				Token name = previous();
+				if (match({ LEFT_BRACKET }))
+				{
+					//	the index is parsed like any other operand sequence
+					operators.push_back({ Operator::INDEX, name, 0 });
+					continue;
+				}
+				if (match({ LEFT_BRACE }))
+				{
+					operators.push_back({ Operator::KEY, name, 0 });
+					continue;
+				}
+				if (match({ LEFT_PAREN }))
+				{
+					const BuiltinInfo* info = findBuiltin(name.lexeme);
+					if (info == nullptr)
+						throw ParseError(name, "Unknown function '" + name.lexeme + "'.");
+					std::vector<Token> arrays;
+					for (int i = 0; i < info->arrays; i++)
+					{
+						if (i > 0)
+							consume(COMMA, "Expect ',' between arguments.");
+						arrays.push_back(consume(IDENTIFIER, "Expect array name."));
+					}
+					auto call = std::make_unique<CallExpr>(name, info->builtin, std::move(arrays));
+					if (info->scalars == 0)
+					{
+						consume(RIGHT_PAREN, "Expect ')' after arguments.");
+						operands.push_back({ std::move(call), 1 });
+					}
+					else
+					{
+						//	the other arguments are parsed like any other operand sequence
+						consume(COMMA, "Expect ',' between arguments.");
+						calls.push_back({ std::move(call), 1 });
+						operators.push_back({ Operator::CALL, name, 0 });
+						continue;
+					}
+				}
+				else
+					operands.push_back({ std::make_unique<VariableExpr>(name), 1 });
+			}
+			else if (match({ INPUT }))
+			{
+				operands.push_back({ std::make_unique<InputExpr>(), 1 });
+			}
+			else
+			{
+				throw ParseError(peek(), "Expected expression");
+			}
+
+			//	binary operators and closing brackets after the operand
+			while (true)
+			{
+				while (!operators.empty() && operators.back().kind == Operator::UNARY)
+					reduce(operands, operators);
+
+				int level = isAtEnd() ? 0 : precedence(peek().type);
+				if (level > 0)
+				{
+					//	left associative, equal precedence reduces first
+					while (!operators.empty() && operators.back().kind == Operator::BINARY && operators.back().precedence >= level)
+						reduce(operands, operators);
+					operators.push_back({ Operator::BINARY, advance(), level });
+					break;
+				}
+
+				if (match({ ARROW, EQUAL }))
+				{
+					//	right associative and binds loosest, the target is
+					//	everything since the last bracket or assignment
+					Token token = previous();
+					while (!operators.empty() && operators.back().kind == Operator::BINARY)
+						reduce(operands, operators);
+					operators.push_back({ Operator::ASSIGN, token, 0 });
+					break;
+				}
+
+				while (!operators.empty() && (operators.back().kind == Operator::BINARY || operators.back().kind == Operator::ASSIGN))
+					reduce(operands, operators);
+
+				if (operators.empty())
+				{
+					Operand result = std::move(operands.back());
+					if (result.depth > maxRecursiveDepth)
+						return std::make_unique<DeepExpr>(std::move(result.expr));
+					return std::move(result.expr);
+				}
+
+				//	the innermost open bracket closes around the operand
+				Operand& inner = operands.back();
+				if (operators.back().kind == Operator::CALL)
+				{
+					Operand& call = calls.back();
+					CallExpr& callExpr = static_cast<CallExpr&>(*call.expr);
+					callExpr.arguments.push_back(std::move(inner.expr));
+					call.depth = std::max(call.depth, inner.depth + 1);
+					operands.pop_back();
+					if (static_cast<int>(callExpr.arguments.size()) < builtinInfo(callExpr.builtin).scalars)
+					{
+						consume(COMMA, "Expect ',' between arguments.");
+						break;
+					}
+					consume(RIGHT_PAREN, "Expect ')' after arguments.");
+					operands.push_back(std::move(call));
+					calls.pop_back();
+					operators.pop_back();
+					continue;
+				}
+				if (operators.back().kind == Operator::GROUP)
+				{
+					consume(RIGHT_PAREN, "Expected ')' after expression");
+					inner.expr = std::make_unique<GroupingExpr>(std::move(inner.expr));
+				}
+				else if (operators.back().kind == Operator::KEY)
+				{
+					consume(RIGHT_BRACE, "Expect '}' after map key.");
+					inner.expr = std::make_unique<MapAccessExpr>(operators.back().token, std::move(inner.expr));
+				}
+				else
+				{
+					consume(RIGHT_BRACKET, "Expect ']' after array index.");
+					inner.expr = std::make_unique<ArrayAccessExpr>(operators.back().token, std::move(inner.expr));
+				}
+				inner.depth++;
+				operators.pop_back();
+			}
 		}
 	}
-
-	if (match({ EQUAL }))
+	catch (...)
 	{
-		Token equals = previous();
-		std::unique_ptr<Expr> value = assignment();
-
-		if (ArrayAccessExpr* arrayAccess = dynamic_cast<ArrayAccessExpr*>(expr.get()))
-		{
-			Token name = arrayAccess->name;
-			std::unique_ptr<Expr> index = std::move(arrayAccess->index);
-			return std::make_unique<ArraySetExpr>(name, std::move(index), std::move(value));
-		}
-
-		//	instanceof (dirty idc)
-		if (VariableExpr* variable = dynamic_cast<VariableExpr*>(expr.get()))
-		{
-			Token name = variable->name;
-			return std::make_unique<AssignmentExpr>(name, std::move(value));
-		}
-
-		Vous::error(equals, "Invalid assignment target.");
+		for (auto& operand : operands)
+			dismantle(std::move(operand.expr));
+		for (auto& call : calls)
+			dismantle(std::move(call.expr));
+		throw;
 	}
-	return expr;
 }
 
-std::unique_ptr<Expr> Parser::logical()
+//	applies the operator on top of the stack to the operands it takes
+void Parser::reduce(std::vector<Operand>& operands, std::vector<Operator>& operators)
 {
-	auto expr = equality();
+	Operator op = std::move(operators.back());
+	operators.pop_back();
+	Operand right = std::move(operands.back());
+	operands.pop_back();
 
-	while (match({ AND_AND, PIPE_PIPE }))
+	if (op.kind == Operator::UNARY)
 	{
-		Token op = previous();
-		auto right = equality();
-		expr = std::make_unique<BinaryExpr>(std::move(expr), op, std::move(right));
+		operands.push_back({ std::make_unique<UnaryExpr>(op.token, std::move(right.expr)), right.depth + 1 });
+		return;
 	}
 
-	return expr;
-}
-
-std::unique_ptr<Expr> Parser::equality()
-{
-	auto expr = comparison();
-
-	while (match({ BANG_EQUAL, EQUAL_EQUAL }))
+	Operand& left = operands.back();
+	left.depth = std::max(left.depth, right.depth) + 1;
+	if (op.kind == Operator::BINARY && op.token.type == IN)
 	{
-		Token op = previous();
-		auto right = comparison();
-		expr = std::make_unique<BinaryExpr>(std::move(expr), op, std::move(right));
+		if (VariableExpr* map = dynamic_cast<VariableExpr*>(right.expr.get()))
+		{
+			left.expr = std::make_unique<MapContainsExpr>(map->name, std::move(left.expr));
+			return;
+		}
+		context.error(op.token, "Expect map name after 'in'.");
+		dismantle(std::move(right.expr));
+		return;
 	}
-
-	return expr;
-}
-
-std::unique_ptr<Expr> Parser::comparison()
-{
-	auto expr = term();
-
-	while (match({ GREATER, GREATER_EQUAL, LESS, LESS_EQUAL, EQUAL_EQUAL }))
+	if (op.kind == Operator::BINARY)
 	{
-		Token op = previous();
-		auto right = term();
-		expr = std::make_unique<BinaryExpr>(std::move(expr), op, std::move(right));
+		left.expr = std::make_unique<BinaryExpr>(std::move(left.expr), op.token, std::move(right.expr));
+		return;
 	}
 
-	return expr;
-}
-
-std::unique_ptr<Expr> Parser::term()
-{
-	auto expr = factor();
-
-	while (match({ PLUS, MINUS }))
+	if (op.token.type == ARROW)
 	{
-		Token op = previous();
-		auto right = factor();
-		expr = std::make_unique<BinaryExpr>(std::move(expr), op, std::move(right));
+		if (VariableExpr* variable = dynamic_cast<VariableExpr*>(left.expr.get()))
+		{
+			Token name = variable->name;
+			left.expr = std::make_unique<ArrayPushExpr>(name, std::move(right.expr));
+			return;
+		}
+		dismantle(std::move(right.expr));
+		return;
 	}
 
-	return expr;
-}
-
-std::unique_ptr<Expr> Parser::factor()
-{
-	auto expr = unary();
-
-	while (match({ STAR, SLASH , PERCENT }))
+	if (MapAccessExpr* mapAccess = dynamic_cast<MapAccessExpr*>(left.expr.get()))
 	{
-		Token op = previous();
-		auto right = unary();
-		expr = std::make_unique<BinaryExpr>(std::move(expr), op, std::move(right));
+		Token name = mapAccess->name;
+		std::unique_ptr<Expr> key = std::move(mapAccess->key);
+		left.expr = std::make_unique<MapSetExpr>(name, std::move(key), std::move(right.expr));
+		return;
 	}
 
-	return expr;
-}
-
-std::unique_ptr<Expr> Parser::unary()
-{
-	if (match({ MINUS, BANG }))
+	if (ArrayAccessExpr* arrayAccess = dynamic_cast<ArrayAccessExpr*>(left.expr.get()))
 	{
-		Token op = previous();
-		auto right = unary();
-		return std::make_unique<UnaryExpr>(op, std::move(right));
+		Token name = arrayAccess->name;
+		std::unique_ptr<Expr> index = std::move(arrayAccess->index);
+		left.expr = std::make_unique<ArraySetExpr>(name, std::move(index), std::move(right.expr));
+		return;
 	}
 
-	return primary();
-}
-
-std::unique_ptr<Expr> Parser::primary()
-{
-	if (match({ NUMBER_LITERAL, STRING_LITERAL, TRUE, FALSE }))
-		return std::make_unique<LiteralExpr>(previous());
-
-	if (match({ IDENTIFIER }))
+	//	instanceof (dirty idc)
+	if (VariableExpr* variable = dynamic_cast<VariableExpr*>(left.expr.get()))
 	{
-		Token name = previous();
-		if (match({ LEFT_BRACKET }))
-		{
-			std::unique_ptr<Expr> index = expression();
-			consume(RIGHT_BRACKET, "Expect ']' after array index.");
-			return std::make_unique<ArrayAccessExpr>(name, std::move(index));
-		}
-		return std::make_unique<VariableExpr>(previous());
+		Token name = variable->name;
+		left.expr = std::make_unique<AssignmentExpr>(name, std::move(right.expr));
+		return;
 	}
 
-	if (match({ INPUT }))
-		return std::make_unique<InputExpr>();
+	context.error(op.token, "Invalid assignment target.");
+	dismantle(std::move(right.expr));
+}
 
-	if (match({ LEFT_PAREN }))
+//	binding strength of binary operators, 0 for anything else
+//	'==' has always been parsed alongside the relational operators
+//	the bitwise operators bind tighter than comparisons, so 'x & 1 == 1'
+//	tests the low bit
+int Parser::precedence(TokenType type)
+{
+	switch (type)
 	{
-		auto expr = expression();
-		consume(RIGHT_PAREN, "Expected ')' after expression");
-		return std::make_unique<GroupingExpr>(std::move(expr));
+	case AND_AND:
+	case PIPE_PIPE:
+		return 1;
+	case BANG_EQUAL:
+		return 2;
+	case GREATER:
+	case GREATER_EQUAL:
+	case LESS:
+	case LESS_EQUAL:
+	case EQUAL_EQUAL:
+	case IN:
+		return 3;
+	case PIPE:
+		return 4;
+	case AND:
+		return 5;
+	case LESS_LESS:
+	case GREATER_GREATER:
+		return 6;
+	case PLUS:
+	case MINUS:
+		return 7;
+	case STAR:
+	case SLASH:
+	case PERCENT:
+		return 8;
+	default:
+		return 0;
 	}
-
-	throw ParseError(peek(), "Expected expression");
-	return nullptr;
 }
 
 bool Parser::isAtEnd()
@@ -409,6 +860,10 @@ void Parser::synchronize()
 		case IF:
 		case WHILE:
 		case FOR:
+		case PARALLEL:
+		case EVOKE:
+		case POST:
+		case DELETE:
 			return;
 		}
 		advance();
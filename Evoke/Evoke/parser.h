@@ -2,9 +2,11 @@
 #include <vector>
 #include <memory>
 #include <exception>
+#include <unordered_map>
+#include <set>
 #include "token.h"
 #include "expr.h"
-#include "vous.h"
+#include "context.h"
 #include "stmt.h"
 
 class ParseError : public std::exception {
@@ -23,30 +25,90 @@ class Parser
 {
 public:
 	std::vector<std::unique_ptr<Stmt>> parse();
-	explicit Parser(std::vector<Token> tokens);
+	//	errors are reported to context
+	Parser(std::vector<Token> tokens, Context& context);
+
+	//	event names in the order they were interned, indexed by event id
+	const std::vector<std::string>& events() const { return eventNames; }
+	//	arrays declared as views and the arrays they were taken from
+	const std::set<std::string>& views() const { return viewNames; }
+
+	//	statements and expressions nested deeper than this are wrapped so the
+	//	interpreter runs them on an explicit stack instead of recursing
+	static const int maxRecursiveDepth = 256;
 private:
 	const std::vector<Token> tokens;
+	Context& context;
 	int current = 0;
-	std::unique_ptr<Stmt> declaration();
+
+	//	statements are parsed without recursion, every open block or compound
+	//	statement waiting for its body is a frame
+	struct StmtFrame
+	{
+		enum Kind { BLOCK, IF_THEN, IF_ELSE, WHILE, FOR, PARALLEL };
+
+		Kind kind = BLOCK;
+		std::vector<std::unique_ptr<Stmt>> stmts = {};
+		std::unique_ptr<Expr> condition = nullptr;
+		std::unique_ptr<Stmt> thenBranch = nullptr;
+		std::unique_ptr<Stmt> initializer = nullptr;
+		std::unique_ptr<Expr> increment = nullptr;
+		//	parallel loops, the 'parallel' keyword and the reductions
+		Token keyword = Token();
+		std::vector<ParallelStmt::Reduction> reductions = {};
+		//	deepest statement nesting below this frame so far
+		int depth = 0;
+	};
+	std::vector<StmtFrame> frames;
+	//	the statement being parsed sits directly in the program
+	bool topLevel = false;
+
+	std::unordered_map<std::string, int> eventIds;
+	std::vector<std::string> eventNames;
+	std::set<std::string> viewNames;
+
+	std::unique_ptr<Stmt> statement(bool declaration);
+	void deliver(std::unique_ptr<Stmt> stmt, int depth);
+	void closeBlock();
+	void recover(const ParseError& error);
+	void popFrame();
 	std::unique_ptr<Stmt> varDeclaration();
 	std::unique_ptr<Stmt> arrDeclaration();
-	std::unique_ptr<Stmt> statement();
+	void arrayElements(ArrayStmt& array);
+	void arraySlice(ArrayStmt& array);
+	static std::unique_ptr<Array> constantArray(const std::vector<std::unique_ptr<Expr>>& elements);
+	std::unique_ptr<Stmt> mapDeclaration();
+	std::unique_ptr<Stmt> deleteStatement();
 	std::unique_ptr<Stmt> printStatement();
 	std::unique_ptr<Stmt> expressionStatement();
-	std::unique_ptr<Stmt> blockStatement();
-	std::unique_ptr<Stmt> ifStatement();
-	std::unique_ptr<Stmt> whileStatement();
-	std::unique_ptr<Stmt> forStatement();
+	std::unique_ptr<Stmt> evokeStatement(bool deferred);
+	std::unique_ptr<Stmt> subscription(std::unique_ptr<Stmt> stmt);
+	int eventId(const std::string& name);
+	void ifStatement();
+	void whileStatement();
+	void forStatement();
+	std::unique_ptr<Stmt> forLoop(StmtFrame& frame, std::unique_ptr<Stmt> body);
+	void parallelStatement();
+	std::unique_ptr<Stmt> parallelLoop(StmtFrame& frame, std::unique_ptr<Stmt> body);
+
+	//	expressions use operator precedence parsing with explicit stacks
+	struct Operand
+	{
+		std::unique_ptr<Expr> expr;
+		int depth;
+	};
+	struct Operator
+	{
+		enum Kind { UNARY, BINARY, GROUP, INDEX, KEY, ASSIGN, CALL };
+
+		Kind kind;
+		Token token;
+		int precedence;
+	};
 
 	std::unique_ptr<Expr> expression();
-	std::unique_ptr<Expr> assignment();
-	std::unique_ptr<Expr> logical();
-	std::unique_ptr<Expr> equality();
-	std::unique_ptr<Expr> comparison();
-	std::unique_ptr<Expr> term();
-	std::unique_ptr<Expr> factor();
-	std::unique_ptr<Expr> unary();
-	std::unique_ptr<Expr> primary();
+	void reduce(std::vector<Operand>& operands, std::vector<Operator>& operators);
+	static int precedence(TokenType type);
 
 	void synchronize();
 
@@ -0,0 +1,110 @@
+#include "pool.h"
+
+WorkerPool::WorkerPool(unsigned count)
+{
+	if (count == 0)
+		count = 1;
+	for (unsigned i = 0; i < count; i++)
+		queues.push_back(std::make_unique<Queue>());
+	for (unsigned i = 1; i < count; i++)
+		threads.emplace_back(&WorkerPool::loop, this, i);
+}
+
+WorkerPool::~WorkerPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stopping = true;
+	}
+	wake.notify_all();
+	for (auto& thread : threads)
+		thread.join();
+}
+
+void WorkerPool::run(size_t count, const std::function<void(size_t, unsigned)>& task)
+{
+	if (count == 0)
+		return;
+
+	//	set before any task is visible, a worker still busy from the previous
+	//	batch can pick up tasks of this one
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		this->task = &task;
+		remaining = count;
+	}
+	for (size_t i = 0; i < count; i++)
+	{
+		Queue& queue = *queues[i % queues.size()];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		queue.tasks.push_back(i);
+	}
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		batch++;
+	}
+	wake.notify_all();
+
+	work(0);
+
+	std::unique_lock<std::mutex> lock(mutex);
+	done.wait(lock, [this]() { return remaining == 0; });
+	this->task = nullptr;
+}
+
+void WorkerPool::loop(unsigned worker)
+{
+	unsigned long long seen = 0;
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			wake.wait(lock, [&]() { return stopping || batch != seen; });
+			if (stopping)
+				return;
+			seen = batch;
+		}
+		work(worker);
+	}
+}
+
+void WorkerPool::work(unsigned worker)
+{
+	size_t index;
+	while (next(worker, index))
+	{
+		(*task)(index, worker);
+
+		std::lock_guard<std::mutex> lock(mutex);
+		if (--remaining == 0)
+			done.notify_all();
+	}
+}
+
+//	own deque from the back, others from the front
+bool WorkerPool::next(unsigned worker, size_t& index)
+{
+	{
+		Queue& own = *queues[worker];
+		std::lock_guard<std::mutex> lock(own.mutex);
+		if (!own.tasks.empty())
+		{
+			index = own.tasks.back();
+			own.tasks.pop_back();
+			return true;
+		}
+	}
+
+	for (size_t i = 1; i < queues.size(); i++)
+	{
+		Queue& victim = *queues[(worker + i) % queues.size()];
+		std::lock_guard<std::mutex> lock(victim.mutex);
+		if (!victim.tasks.empty())
+		{
+			index = victim.tasks.front();
+			victim.tasks.pop_front();
+			return true;
+		}
+	}
+	return false;
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+//	fixed set of threads with one task deque each
+//	a batch is dealt round robin over the deques, a worker that runs out takes
+//	from the front of the others' deques, the thread calling run is worker 0
+class WorkerPool
+{
+public:
+	//	count includes the calling thread
+	explicit WorkerPool(unsigned count);
+	~WorkerPool();
+
+	unsigned size() const { return static_cast<unsigned>(queues.size()); }
+
+	//	calls task(index, worker) for every index below count, returns once all
+	//	have finished, task must not throw
+	void run(size_t count, const std::function<void(size_t, unsigned)>& task);
+
+private:
+	struct Queue
+	{
+		std::mutex mutex;
+		std::deque<size_t> tasks;
+	};
+
+	void loop(unsigned worker);
+	void work(unsigned worker);
+	bool next(unsigned worker, size_t& index);
+
+	std::vector<std::unique_ptr<Queue>> queues;
+	std::vector<std::thread> threads;
+
+	std::mutex mutex;
+	std::condition_variable wake;
+	std::condition_variable done;
+	const std::function<void(size_t, unsigned)>* task = nullptr;
+	size_t remaining = 0;
+	unsigned long long batch = 0;
+	bool stopping = false;
+};
@@ -1,8 +1,10 @@
-#include "Scanner.h"
+#include "scanner.h"
 #include <bitset>
+#include <iostream>
 
 const std::unordered_map<std::string, TokenType> Scanner::keywords = {
 	{"var", VAR},
+	{"byte", VAR},
 	{"print", PRINT},
 	{"[]", ARRAY},
 	{"input", INPUT},
@@ -11,10 +13,16 @@ const std::unordered_map<std::string, TokenType> Scanner::keywords = {
 	{"if", IF},
 	{"else", ELSE},
 	{"while", WHILE},
-	{"for",  FOR}
+	{"for",  FOR},
+	{"parallel", PARALLEL},
+	{"evoke", EVOKE},
+	{"emit", EVOKE},
+	{"post", POST},
+	{"in", IN},
+	{"delete", DELETE}
 };
 
-Scanner::Scanner(std::string source) : source(source), start(0), current(0), line(1), currentOnLine(0) {}
+Scanner::Scanner(std::string source, Context& context) : start(0), current(0), line(1), currentOnLine(0), source(source), context(context) {}
 
 std::vector<Token> Scanner::scanTokens()
 {
@@ -124,7 +132,7 @@ void Scanner::scanToken()
 		else if (isalpha(c) || c == '_')
 			handleIdentifier();
 		else
-			Vous::error(line, "Unexpected character: '" + std::string(1, c) + "'" + "at: " + std::to_string(currentOnLine));
+			context.error(line, "Unexpected character: '" + std::string(1, c) + "'" + "at: " + std::to_string(currentOnLine));
 	}
 }
 
@@ -179,9 +187,18 @@ void Scanner::handleDigit()
 		while (isdigit(peek()))
 			advance();
 	}
+	else
+	{
+		//	no fraction, an integer unless it doesn't fit in 64 bits
+		int64_t value;
+		if (parseInteger(source.data() + start, source.data() + current, value))
+		{
+			addToken(TokenType::NUMBER_LITERAL, Value(value));
+			return;
+		}
+	}
 
-	int length = getLength(start, current);
-	double value = std::stod(source.substr(start, length));
+	double value = parseNumber(source.data() + start, source.data() + current);
 	addToken(TokenType::NUMBER_LITERAL, Value(value));
 }
 
@@ -224,7 +241,7 @@ void Scanner::handleString() {
 
 	if (isAtEnd())
 	{
-		Vous::error(line, "Unterminated string");
+		context.error(line, "Unterminated string");
 		return;
 	}
 
@@ -234,7 +251,11 @@ void Scanner::handleString() {
 	//	trim the surrounding quotes
 	int length = getLength(start + 1, current - 1);
 	std::string value = source.substr(start + 1, length);
-	addToken(STRING_LITERAL, Value(value));
+	//	equal literals share one buffer, map keys compare by it first
+	auto it = strings.find(value);
+	if (it == strings.end())
+		it = strings.emplace(value, Value(value)).first;
+	addToken(STRING_LITERAL, it->second);
 }
 
 void Scanner::handleBool()
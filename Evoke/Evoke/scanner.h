@@ -3,14 +3,15 @@
 #include <unordered_map>
 #include <string>
 #include "token.h"
-#include "vous.h"
+#include "context.h"
 #include "value.h"
 
 
 class Scanner
 {
 public:
-	Scanner(std::string source);
+	//	errors are reported to context
+	Scanner(std::string source, Context& context);
 	std::vector<Token> scanTokens();
 	void printResult();
 
@@ -23,7 +24,9 @@ private:
 	int currentOnLine;
 
 	const std::string source;
+	Context& context;
 	std::vector<Token> tokens;
+	std::unordered_map<std::string, Value> strings;
 
 	bool isAtEnd();
 	void scanToken();
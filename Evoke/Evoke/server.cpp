@@ -0,0 +1,296 @@
+#include "server.h"
+#include "context.h"
+#include "scanner.h"
+#include "parser.h"
+#include "optimizer.h"
+#include "interpreter.h"
+#include <thread>
+#include <iostream>
+#include <functional>
+#ifndef _WIN32
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#endif
+
+Server::Server(Options options) : options(options)
+{
+}
+
+std::shared_ptr<const Server::Program> Server::compile(const std::string& source)
+{
+	size_t digest = std::hash<std::string>()(source);
+	{
+		std::lock_guard<std::mutex> lock(cacheLock);
+		auto found = cache.find(digest);
+		if (found != cache.end() && found->second->source == source)
+		{
+			recent.splice(recent.begin(), recent, found->second);
+			return found->second->program;
+		}
+	}
+
+	//	parsed outside the lock, two threads sending the same new script at
+	//	once both parse it and the first one in is kept
+	auto program = std::make_shared<Program>();
+	Context context(program->errors);
+	Scanner scanner(source, context);
+	Parser parser(scanner.scanTokens(), context);
+	program->statements = parser.parse();
+	context.output.flush();
+	if (!context.hadError)
+	{
+		if (options.optimize)
+			Optimizer().optimize(program->statements, parser.views());
+		program->events.build(program->statements, parser.events().size(), parser.views(), options.optimize);
+	}
+
+	std::lock_guard<std::mutex> lock(cacheLock);
+	auto found = cache.find(digest);
+	if (found != cache.end())
+	{
+		if (found->second->source == source)
+			return found->second->program;
+		//	another script with the same digest, the newer one takes its place
+		cachedBytes -= found->second->source.size();
+		recent.erase(found->second);
+		cache.erase(found);
+	}
+	if (source.size() > cacheBytes)
+		return program;
+	recent.push_front(Cached{ digest, source, program });
+	cache.emplace(digest, recent.begin());
+	cachedBytes += source.size();
+	while (cachedBytes > cacheBytes)
+	{
+		cachedBytes -= recent.back().source.size();
+		cache.erase(recent.back().digest);
+		recent.pop_back();
+	}
+	return program;
+}
+
+#ifdef _WIN32
+
+bool Server::serve(const std::string& path)
+{
+	std::cerr << "Server mode needs unix domain sockets, which this build doesn't have" << std::endl;
+	return false;
+}
+
+int Server::submit(const std::string& path, const std::string& script, const std::string& input, std::string& output)
+{
+	std::cerr << "Server mode needs unix domain sockets, which this build doesn't have" << std::endl;
+	return -1;
+}
+
+void Server::work(int listener)
+{
+}
+
+#else
+
+static bool readAll(int fd, std::string& text, size_t size)
+{
+	text.resize(size);
+	size_t done = 0;
+	while (done < size)
+	{
+		ssize_t count = read(fd, &text[done], size - done);
+		if (count < 0 && errno == EINTR)
+			continue;
+		if (count <= 0)
+			return false;
+		done += count;
+	}
+	return true;
+}
+
+static bool writeAll(int fd, const std::string& text)
+{
+	size_t done = 0;
+	while (done < text.size())
+	{
+		ssize_t count = write(fd, text.data() + done, text.size() - done);
+		if (count < 0 && errno == EINTR)
+			continue;
+		if (count <= 0)
+			return false;
+		done += count;
+	}
+	return true;
+}
+
+//	"<number> <number>\n", read a byte at a time so nothing after it is taken
+static bool readHeader(int fd, size_t& first, size_t& second)
+{
+	std::string header;
+	char c;
+	while (header.size() < 64)
+	{
+		ssize_t count = read(fd, &c, 1);
+		if (count < 0 && errno == EINTR)
+			continue;
+		if (count <= 0)
+			return false;
+		if (c == '\n')
+		{
+			unsigned long long a, b;
+			if (std::sscanf(header.c_str(), "%llu %llu", &a, &b) != 2)
+				return false;
+			first = a;
+			second = b;
+			return true;
+		}
+		header += c;
+	}
+	return false;
+}
+
+static bool socketAddress(const std::string& path, sockaddr_un& address)
+{
+	address = sockaddr_un();
+	address.sun_family = AF_UNIX;
+	if (path.size() >= sizeof(address.sun_path))
+		return false;
+	path.copy(address.sun_path, path.size());
+	return true;
+}
+
+bool Server::serve(const std::string& path)
+{
+	sockaddr_un address;
+	if (!socketAddress(path, address))
+	{
+		std::cerr << "Socket path too long: " << path << std::endl;
+		return false;
+	}
+	int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+	unlink(path.c_str());
+	if (listener < 0 || bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0
+		|| listen(listener, SOMAXCONN) != 0)
+	{
+		std::cerr << "Can't listen on " << path << std::endl;
+		return false;
+	}
+	//	a client that hangs up early shouldn't end the server
+	signal(SIGPIPE, SIG_IGN);
+
+	//	every thread accepts on its own, the kernel hands each connection to
+	//	one of them
+	std::vector<std::thread> threads;
+	for (unsigned i = 1; i < options.threads; i++)
+		threads.emplace_back(&Server::work, this, listener);
+	work(listener);
+	for (auto& thread : threads)
+		thread.join();
+	close(listener);
+	return true;
+}
+
+void Server::work(int listener)
+{
+	std::string printed;
+	std::string script;
+	std::string input;
+	Context context(printed);
+	const Interpreter interpreter(context);
+	interpreter.useReactive(options.reactive);
+
+	while (true)
+	{
+		int connection = accept(listener, nullptr, nullptr);
+		if (connection < 0)
+		{
+			if (errno == EINTR || errno == ECONNABORTED)
+				continue;
+			return;
+		}
+		//	a stalled client fails its reads and writes instead of holding
+		//	this thread
+		timeval timeout = timeval();
+		timeout.tv_sec = ioTimeout;
+		setsockopt(connection, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+		setsockopt(connection, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+		size_t scriptSize, inputSize;
+		if (!readHeader(connection, scriptSize, inputSize))
+		{
+			close(connection);
+			continue;
+		}
+
+		//	sizes are checked before anything is allocated for them
+		bool clean = false;
+		bool answer = true;
+		if (scriptSize > maxScript || inputSize > maxInput)
+			printed = "Request too large, a script can be up to " + std::to_string(maxScript) + " bytes and its input up to "
+				+ std::to_string(maxInput) + ".\n";
+		else
+		{
+			//	a request that fails outside the script's own errors, such as
+			//	running out of memory, only fails its own connection
+			try
+			{
+				answer = readAll(connection, script, scriptSize) && readAll(connection, input, inputSize);
+				if (answer)
+				{
+					std::shared_ptr<const Program> program = compile(script);
+					clean = program->errors.empty();
+					printed = program->errors;
+					if (clean)
+					{
+						context.input.setText(input);
+						interpreter.reset();
+						clean = interpreter.interpret(program->statements, program->events);
+						context.output.flush();
+					}
+				}
+			}
+			catch (const std::exception& error)
+			{
+				context.output.flush();
+				printed = std::string("Request failed: ") + error.what() + "\n";
+				clean = false;
+			}
+		}
+		if (answer)
+		{
+			std::string header = std::to_string(clean ? 0 : 1) + " " + std::to_string(printed.size()) + "\n";
+			if (writeAll(connection, header))
+				writeAll(connection, printed);
+		}
+		printed.clear();
+		close(connection);
+	}
+}
+
+int Server::submit(const std::string& path, const std::string& script, const std::string& input, std::string& output)
+{
+	sockaddr_un address;
+	if (!socketAddress(path, address))
+		return -1;
+	int connection = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (connection < 0)
+		return -1;
+	if (connect(connection, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0)
+	{
+		close(connection);
+		return -1;
+	}
+
+	int status = -1;
+	size_t code, size;
+	std::string header = std::to_string(script.size()) + " " + std::to_string(input.size()) + "\n";
+	if (writeAll(connection, header) && writeAll(connection, script) && writeAll(connection, input)
+		&& readHeader(connection, code, size) && readAll(connection, output, size))
+		status = static_cast<int>(code);
+	close(connection);
+	return status;
+}
+
+#endif
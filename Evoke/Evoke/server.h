@@ -0,0 +1,67 @@
+#pragma once
+#include <string>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include "options.h"
+#include "stmt.h"
+#include "events.h"
+
+//	long running mode: scripts arrive over a unix domain socket together with
+//	the text their input expressions read, and what they print is sent back.
+//	parsed programs are kept by a digest of their source, and every serving
+//	thread keeps a warm interpreter and output buffer between requests
+//
+//	request:  "<script bytes> <input bytes>\n" script input
+//	response: "<status> <output bytes>\n" output, status 0 if it ran cleanly
+//	a request larger than the limits below, or one that runs out of memory,
+//	gets status 1 and an error message as its output. a client that stalls
+//	mid request or doesn't take its response is dropped
+class Server
+{
+public:
+	explicit Server(Options options);
+	//	serves on options.threads threads until the process is stopped, false
+	//	if the socket can't be set up
+	bool serve(const std::string& path);
+	//	runs script on the server at path, what it printed ends up in output
+	//	returns the status, or -1 if the server couldn't be reached
+	static int submit(const std::string& path, const std::string& script, const std::string& input, std::string& output);
+
+private:
+	//	a parsed and optimized script, shared by every request that sends it
+	struct Program
+	{
+		std::vector<std::unique_ptr<Stmt>> statements;
+		EventTable events;
+		//	syntax errors, the program isn't run when there are any
+		std::string errors;
+	};
+	//	the source is kept to tell a digest collision from a hit
+	struct Cached
+	{
+		size_t digest;
+		std::string source;
+		std::shared_ptr<const Program> program;
+	};
+	std::shared_ptr<const Program> compile(const std::string& source);
+	void work(int listener);
+
+	//	bytes of source the cached programs can add up to, the least recently
+	//	used go first when a new one doesn't fit
+	static const size_t cacheBytes = 64 << 20;
+	//	largest script and input a request can send
+	static const size_t maxScript = 16 << 20;
+	static const size_t maxInput = 1 << 30;
+	//	seconds a connection can go without sending or taking a byte
+	static const int ioTimeout = 30;
+
+	Options options;
+	std::mutex cacheLock;
+	//	most recently used first
+	std::list<Cached> recent;
+	std::unordered_map<size_t, std::list<Cached>::iterator> cache;
+	size_t cachedBytes = 0;
+};
@@ -0,0 +1,109 @@
+#include "sort.h"
+#include "pool.h"
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <vector>
+
+//	below this the merge costs more than the threads save
+static const size_t parallelSortMin = 1 << 15;
+
+template<typename T, typename Less>
+static void sortRuns(T* data, size_t count, Less less, WorkerPool* pool)
+{
+	if (pool == nullptr || pool->size() < 2 || count < parallelSortMin)
+	{
+		std::sort(data, data + count, less);
+		return;
+	}
+
+	size_t runs = pool->size();
+	std::vector<size_t> bounds;
+	for (size_t run = 0; run <= runs; run++)
+		bounds.push_back(count * run / runs);
+	pool->run(runs, [&](size_t run, unsigned)
+	{
+		std::sort(data + bounds[run], data + bounds[run + 1], less);
+	});
+
+	//	every round merges neighbouring runs into the other buffer, an odd run
+	//	out is moved across as it is
+	std::vector<T> buffer(count);
+	T* from = data;
+	T* to = buffer.data();
+	while (runs > 1)
+	{
+		size_t pairs = (runs + 1) / 2;
+		pool->run(pairs, [&](size_t pair, unsigned)
+		{
+			size_t first = bounds[pair * 2];
+			size_t middle = bounds[std::min(pair * 2 + 1, runs)];
+			size_t last = bounds[std::min(pair * 2 + 2, runs)];
+			std::merge(std::make_move_iterator(from + first), std::make_move_iterator(from + middle),
+				std::make_move_iterator(from + middle), std::make_move_iterator(from + last), to + first, less);
+		});
+		std::vector<size_t> merged;
+		for (size_t pair = 0; pair < pairs; pair++)
+			merged.push_back(bounds[pair * 2]);
+		merged.push_back(count);
+		bounds = std::move(merged);
+		runs = pairs;
+		std::swap(from, to);
+	}
+	if (from != data)
+		std::move(from, from + count, data);
+}
+
+static bool lessNumber(double a, double b)
+{
+	if (a < b)
+		return true;
+	if (std::isnan(a) || std::isnan(b))
+		return !std::isnan(a) && std::isnan(b);
+	return a == b && std::signbit(a) && !std::signbit(b);
+}
+
+//	-1, 0 or 1 as integer is below, equal to or above number. a double that
+//	the integer rounds to is whole, so the two compare as integers unless it
+//	is 2^63, beyond every int64
+static int compareMixed(int64_t integer, double number)
+{
+	if (std::isnan(number))
+		return -1;
+	double rounded = static_cast<double>(integer);
+	if (rounded != number)
+		return rounded < number ? -1 : 1;
+	if (number >= 9223372036854775808.0)
+		return -1;
+	int64_t whole = static_cast<int64_t>(number);
+	return integer < whole ? -1 : integer > whole ? 1 : 0;
+}
+
+void sortNumbers(double* data, size_t count, WorkerPool* pool)
+{
+	sortRuns(data, count, lessNumber, pool);
+}
+
+void sortStrings(Value* data, size_t count, WorkerPool* pool)
+{
+	sortRuns(data, count, [](const Value& a, const Value& b)
+	{
+		return a.getString() < b.getString();
+	}, pool);
+}
+
+void sortNumberValues(Value* data, size_t count, WorkerPool* pool)
+{
+	sortRuns(data, count, [](const Value& a, const Value& b)
+	{
+		bool aInteger = a.getType() == Type::INTEGER;
+		bool bInteger = b.getType() == Type::INTEGER;
+		if (aInteger && bInteger)
+			return a.getInteger() < b.getInteger();
+		if (!aInteger && !bInteger)
+			return lessNumber(a.getDouble(), b.getDouble());
+		if (aInteger)
+			return compareMixed(a.getInteger(), b.getDouble()) <= 0;
+		return compareMixed(b.getInteger(), a.getDouble()) > 0;
+	}, pool);
+}
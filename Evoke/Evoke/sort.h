@@ -0,0 +1,17 @@
+#pragma once
+#include <cstddef>
+#include "value.h"
+
+class WorkerPool;
+
+//	ascending, in place. -0 sorts before 0 and NaN after everything, so
+//	elements that compare equal are identical and the result doesn't depend on
+//	how the work was split. with a pool, large arrays are cut into one run per
+//	worker, sorted there and merged pairwise
+void sortNumbers(double* data, size_t count, WorkerPool* pool);
+//	every element must be a string, compared byte by byte
+void sortStrings(Value* data, size_t count, WorkerPool* pool);
+//	every element must be a number, for arrays holding integers too large to
+//	pack. integers and doubles compare by their exact value, an integer sorts
+//	before a double that equals it
+void sortNumberValues(Value* data, size_t count, WorkerPool* pool);
@@ -1,6 +1,8 @@
 #pragma once
 #include "expr.h"
+#include "array.h"
 #include <memory>
+#include <vector>
 
 class StmtVisitor {
 public:
@@ -11,6 +13,12 @@ public:
 	virtual void visit(const class BlockStmt& stmt) const = 0;
 	virtual void visit(const class IfStmt& stmt) const = 0;
 	virtual void visit(const class WhileStmt& stmt) const = 0;
+	virtual void visit(const class DeepStmt& stmt) const = 0;
+	virtual void visit(const class SubscribedStmt& stmt) const = 0;
+	virtual void visit(const class EvokeStmt& stmt) const = 0;
+	virtual void visit(const class ParallelStmt& stmt) const = 0;
+	virtual void visit(const class MapStmt& stmt) const = 0;
+	virtual void visit(const class DeleteStmt& stmt) const = 0;
 };
 
 class Stmt {
@@ -56,9 +64,20 @@ public:
 	}
 };
 
+//	var[] name; with an optional initializer, [a, b, c], [value; count] or a
+//	view source[first:last] where either bound can be left out
 class ArrayStmt : public Stmt {
 public:
 	Token name;
+	//	the listed elements, or the one fill value when count is set
+	std::vector<std::unique_ptr<Expr>> elements;
+	std::unique_ptr<Expr> count;
+	//	a list of literals only, built once by the parser and copied into place
+	std::unique_ptr<Array> constant;
+	bool slice = false;
+	Token source;
+	std::unique_ptr<Expr> first;
+	std::unique_ptr<Expr> last;
 
 	ArrayStmt(Token name)
 		: name(name) {}
@@ -68,6 +87,32 @@ public:
 	}
 };
 
+class MapStmt : public Stmt {
+public:
+	Token name;
+
+	MapStmt(Token name)
+		: name(name) {}
+
+	void accept(const StmtVisitor& visitor) const override {
+		visitor.visit(*this);
+	}
+};
+
+//	delete name{key}, a key that isn't there is ignored
+class DeleteStmt : public Stmt {
+public:
+	Token name;
+	std::unique_ptr<Expr> key;
+
+	DeleteStmt(Token name, std::unique_ptr<Expr> key)
+		: name(name), key(std::move(key)) {}
+
+	void accept(const StmtVisitor& visitor) const override {
+		visitor.visit(*this);
+	}
+};
+
 class BlockStmt : public Stmt
 {
 public:
@@ -95,11 +140,79 @@ public:
 	}
 };
 
+//	top level statement ending in `: EventName`, it doesn't run in program
+//	order, only when its event is evoked
+class SubscribedStmt : public Stmt
+{
+public:
+	Token event;
+	//	interned id of the event name
+	int id;
+	std::unique_ptr<Stmt> stmt;
+
+	SubscribedStmt(Token event, int id, std::unique_ptr<Stmt> stmt)
+		: event(event), id(id), stmt(std::move(stmt)) {}
+
+	void accept(const StmtVisitor& visitor) const override {
+		visitor.visit(*this);
+	}
+};
+
+//	evoke EventName [? condition | ?? condition]
+//	runs every subscriber of the event, once if the condition holds with '?',
+//	for as long as it holds with '??'
+class EvokeStmt : public Stmt
+{
+public:
+	Token name;
+	int id;
+	std::unique_ptr<Expr> condition;
+	bool repeat;
+	//	'post' queues the event to run after the current one instead of running it now
+	bool deferred;
+
+	EvokeStmt(Token name, int id, std::unique_ptr<Expr> condition, bool repeat, bool deferred)
+		: name(name), id(id), condition(std::move(condition)), repeat(repeat), deferred(deferred) {}
+
+	void accept(const StmtVisitor& visitor) const override {
+		visitor.visit(*this);
+	}
+};
+
+//	attached to counted loops by the optimizer
+//	if the range holds at loop entry, every array access in the body that uses
+//	the induction variable plus a constant is known to be in bounds
+struct LoopRange
+{
+	struct ArrayBound
+	{
+		Token name;
+		double minOffset;
+		double maxOffset;
+		//	slot the interpreter stores the resolved array in
+		int slot;
+	};
+
+	Token index;
+	std::unique_ptr<Expr> limit;
+	bool inclusive;
+	std::vector<ArrayBound> arrays;
+};
+
+//	loop invariant expression evaluated once at loop entry
+struct HoistedExpr
+{
+	int slot;
+	std::unique_ptr<Expr> expr;
+};
+
 class WhileStmt : public Stmt
 {
 public:
 	std::unique_ptr<Expr> condition;
 	std::unique_ptr<Stmt> body;
+	std::unique_ptr<LoopRange> range;
+	std::vector<HoistedExpr> hoisted;
 
 	WhileStmt(std::unique_ptr<Expr> condition, std::unique_ptr<Stmt> body) 
 		: condition(std::move(condition)), body(std::move(body)) {}
@@ -107,4 +220,54 @@ public:
 	void accept(const StmtVisitor& visitor) const override {
 		visitor.visit(*this);
 	}
-};
\ No newline at end of file
+};
+
+//	wraps a top level statement nested too deep to execute recursively
+//	the interpreter runs it on an explicit frame stack
+class DeepStmt : public Stmt
+{
+public:
+	std::unique_ptr<Stmt> stmt;
+
+	explicit DeepStmt(std::unique_ptr<Stmt> stmt) : stmt(std::move(stmt)) {}
+	~DeepStmt() override;
+
+	void accept(const StmtVisitor& visitor) const override {
+		visitor.visit(*this);
+	}
+};
+
+//	parallel [( op name, ... )] for (var i = from; i < to; i = i + 1) body
+//	the index range is cut into chunks that run on the worker pool, the parser
+//	has checked that iterations only write their own locals, the reductions
+//	and shared arrays at index i
+//	every chunk starts the reductions at the identity of their operator, the
+//	partial results are folded into the variables in chunk order
+class ParallelStmt : public Stmt
+{
+public:
+	struct Reduction
+	{
+		//	'+', '*', or the identifier min or max
+		Token op;
+		Token name;
+	};
+
+	Token index;
+	std::unique_ptr<Expr> from;
+	std::unique_ptr<Expr> to;
+	bool inclusive;
+	std::vector<Reduction> reductions;
+	std::unique_ptr<Stmt> body;
+	//	shared arrays the iterations write at the loop index
+	std::vector<std::string> sharedWrites;
+
+	ParallelStmt(Token index, std::unique_ptr<Expr> from, std::unique_ptr<Expr> to, bool inclusive,
+		std::vector<Reduction> reductions, std::unique_ptr<Stmt> body)
+		: index(index), from(std::move(from)), to(std::move(to)), inclusive(inclusive),
+		reductions(std::move(reductions)), body(std::move(body)) {}
+
+	void accept(const StmtVisitor& visitor) const override {
+		visitor.visit(*this);
+	}
+};
@@ -1,4 +1,4 @@
-#include "Token.h"
+#include "token.h"
 
 const std::unordered_map<TokenType, std::string> Token::enumStrings = {
 	{LEFT_PAREN, "LEFT_PAREN"}, {RIGHT_PAREN, "RIGHT_PAREN"},
@@ -17,6 +17,8 @@ const std::unordered_map<TokenType, std::string> Token::enumStrings = {
 	{QUESTION, "QUESTION"}, {QUESTION_QUESTION, "QUESTION_QUESTION"},
 	{IDENTIFIER, "IDENTIFIER"}, {NUMBER_LITERAL, "BYTE_LITERAL"}, {STRING_LITERAL, "STRING_LITERAL"}, {TRUE, "TRUE"}, {FALSE, "FALSE"},
 	{VAR, "VAR"}, {ARRAY, "ARRAY"}, {PRINT, "PRINT"}, {INPUT, "INPUT"},
+	{IF, "IF"}, {ELSE, "ELSE"}, {WHILE, "WHILE"}, {FOR, "FOR"}, {PARALLEL, "PARALLEL"}, {EVOKE, "EVOKE"}, {POST, "POST"},
+	{IN, "IN"}, {DELETE, "DELETE"},
 	{END_OF_FILE, "END_OF_FILE"},
 	{NONE, "NONE"}
 };
@@ -26,7 +26,7 @@ enum TokenType {
 	IDENTIFIER, NUMBER_LITERAL, STRING_LITERAL, TRUE, FALSE,
 
 	// Keywords.
-	VAR, ARRAY, PRINT, INPUT, IF, ELSE, WHILE, FOR,
+	VAR, ARRAY, PRINT, INPUT, IF, ELSE, WHILE, FOR, PARALLEL, EVOKE, POST, IN, DELETE,
 
 	END_OF_FILE,
 
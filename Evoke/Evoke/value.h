@@ -1,56 +1,95 @@
 #pragma once
 #include <string>
+#include <memory>
 #include <variant>
 #include "types.h"
+#include "numbers.h"
 
 class Value
 {
 public:
 	Value() : value(double(0)) {};
 	Value(double value) : value(value) {};
-	Value(const std::string& value) : value(value) {};
+	//	strings are immutable once created, copies share one buffer so passing
+	//	a string value around (literals, variable reads) doesn't allocate
+	Value(const std::string& value) : value(std::make_shared<const std::string>(value)) {};
+	Value(std::string&& value) : value(std::make_shared<const std::string>(std::move(value))) {};
+	Value(const char* value) : value(std::make_shared<const std::string>(value)) {};
 	Value(bool value) : value(value) {};
+	Value(int64_t value) : value(value) {};
 
-	std::string toString()
+	std::string toString() const
 	{
 		if (getType() == Type::STRING)
 			return getString();
 		else if (getType() == Type::BOOLEAN)
 			return getBool() ? "true" : "false";
-		return std::to_string(getDouble());
+		else if (getType() == Type::INTEGER)
+			return formatInteger(getInteger());
+		return formatNumber(getDouble());
 	}
 
+	//	integers convert, anything else is 0
 	double getDouble() const
 	{
 		if (std::holds_alternative<double>(value))
 			return std::get<double>(value);
+		if (std::holds_alternative<int64_t>(value))
+			return static_cast<double>(std::get<int64_t>(value));
+		return 0;
 	}
 
-	std::string getString() const
+	int64_t getInteger() const
 	{
-		if (std::holds_alternative<std::string>(value))
-			return std::get<std::string>(value);
+		if (std::holds_alternative<int64_t>(value))
+			return std::get<int64_t>(value);
+		return 0;
+	}
+
+	//	DOUBLE or INTEGER, the arithmetic operators take either
+	bool isNumber() const
+	{
+		return std::holds_alternative<double>(value) || std::holds_alternative<int64_t>(value);
+	}
+
+	const std::string& getString() const
+	{
+		static const std::string empty;
+		if (std::holds_alternative<String>(value))
+			return *std::get<String>(value);
+		return empty;
 	}
 
 	bool getBool() const
 	{
 		if (std::holds_alternative<bool>(value))
 			return std::get<bool>(value);
+		return false;
 	}
 
 	void setValue(double value) { value = value; }
 	void setValue(const std::string& v) { value = value; }
 	void setValue(bool value) { value = value; }
 
+	//	both are strings sharing one buffer, equal without looking at the text
+	bool sharesString(const Value& other) const
+	{
+		return std::holds_alternative<String>(value) && std::holds_alternative<String>(other.value)
+			&& std::get<String>(value) == std::get<String>(other.value);
+	}
+
 	Type getType() const {
 		if (std::holds_alternative<double>(value))
 			return Type::DOUBLE;
 		else if (std::holds_alternative<bool>(value))
 			return Type::BOOLEAN;
+		else if (std::holds_alternative<int64_t>(value))
+			return Type::INTEGER;
 		return Type::STRING;
 	}
 
 private:
+	using String = std::shared_ptr<const std::string>;
 
-	std::variant<double, std::string, bool> value;
-};
\ No newline at end of file
+	std::variant<double, String, bool, int64_t> value;
+};
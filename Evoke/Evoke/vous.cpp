@@ -1,41 +1,38 @@
 #include "vous.h"
 #include "parser.h"
 #include "ASTPrinter.h"
+#include "optimizer.h"
+#include "effects.h"
+#include "pool.h"
+#include "server.h"
+#include <chrono>
 
-bool Vous::hadError = false;
-bool Vous::hadRuntimeError = false;
-const Interpreter Vous::interpreter = Interpreter();
-
-Vous::Vous()
-{
-
-}
-
-void Vous::error(int line, std::string message)
+Vous::Vous(Options options) : options(options), interpreter(context)
 {
-	report(line, "", message);
+	setup();
+	if (!options.output.empty() && !context.output.open(options.output))
+		std::cerr << "Error opening output file " << options.output << std::endl;
+	if (options.flush)
+		context.output.setFlush(*options.flush, options.flushBytes);
 }
 
-void Vous::error(Token token, std::string message)
+Vous::Vous(Options options, std::string& sink, std::string_view text) : context(sink, text), options(options), interpreter(context)
 {
-	if (token.type == END_OF_FILE)
-		report(token.line, " at end", message);
-	else
-		report(token.line, " at '" + token.lexeme + "'", message);
+	setup();
 }
 
-void Vous::runtimeError(Token token, std::string message)
+void Vous::setup()
 {
-	hadRuntimeError = true;
-	std::cout << "[line " << token.line << "] Error: " << message << std::endl;
+	interpreter.useWorkers(options.threads);
+	interpreter.useReactive(options.reactive);
 }
 
-void Vous::runFile(const std::string& path)
+std::string Vous::readFile(const std::string& path)
 {
 	//	open file
 	std::ifstream myFile(path);
 	if (!myFile.is_open())
-		std::cout << "Error opening file" << std::endl;
+		context.output.write("Error opening file\n");
 
 	//	convert to string stream
 	std::stringstream buffer;
@@ -43,53 +40,208 @@ void Vous::runFile(const std::string& path)
 	buffer << myFile.rdbuf();
 
 	myFile.close();
+	return buffer.str();
+}
 
-	run(buffer.str());	//	run the file
-	if (hadError)
-		exit(EXIT_FAILURE);
-	if (hadRuntimeError)
+void Vous::runFile(const std::string& path)
+{
+	if (!run(readFile(path)))	//	run the file
 		exit(EXIT_FAILURE);
 }
 
 void Vous::runPrompt()
 {
-	std::string line;
+	std::string_view line;
 
 	while (true)
 	{
 		//	get input from user
-		std::cout << ">";
-		std::getline(std::cin, line);
+		std::cout << ">" << std::flush;
+		if (!context.input.readLine(line))
+			line = std::string_view();
 
 		if (line == "")
 			break;	//	quit if no input
-		//	run input
-		run(line);
-		//	reset hadError so that syntax errors don't kill the session
-		hadError = false;
-		hadRuntimeError = false;
+		//	run input, errors don't end the session since each run clears them
+		run(std::string(line));
 	}
 }
 
-void Vous::run(std::string source)
+bool Vous::run(const std::string& source)
 {
-	Scanner scanner(source);
+	context.hadError = false;
+	context.hadRuntimeError = false;
+
+	Scanner scanner(source, context);
 	std::vector<Token> tokens = scanner.scanTokens();
 	//scanner.printResult();
 
-	Parser parser(tokens);
+	Parser parser(tokens, context);
 	std::vector<std::unique_ptr<Stmt>> statements = parser.parse();
 
-	if (hadError) return;
+	if (context.hadError)
+	{
+		context.output.flush();
+		return false;
+	}
+
+	if (options.optimize)
+		Optimizer().optimize(statements, parser.views());
+
+	auto startTime = std::chrono::steady_clock::now();
+	unsigned long long startDispatches = interpreter.dispatchCount();
+
+	EventTable events;
+	events.build(statements, parser.events().size(), parser.views(), options.optimize);
+	if (options.dot)
+	{
+		events.writeDot(std::cout, parser.events());
+		return true;
+	}
+	context.hadRuntimeError = !interpreter.interpret(statements, events);
 
-	interpreter.interpret(statements);
+	if (options.stats)
+	{
+		auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime);
+		std::cerr << "[stats] dispatches: " << interpreter.dispatchCount() - startDispatches
+			<< " time: " << elapsed.count() << " ms" << std::endl;
+	}
 
+	context.output.flush();
+	return !context.hadRuntimeError;
 }
 
-void Vous::report(int line, std::string location, std::string& message)
+void Vous::runRemote(const std::string& server, const std::string& path)
 {
-	std::cout << "[line " << line << "] Error" << location << ": " << message << std::endl;
-	hadError = true;
+	std::string script = readFile(path);
+	std::string text;
+	std::string_view lines;
+	while (context.input.readLines(lines, Input::blockSize))
+		text.append(lines);
+
+	std::string printed;
+	int status = Server::submit(server, script, text, printed);
+	if (status < 0)
+	{
+		std::cerr << "Can't reach a server on " << server << std::endl;
+		exit(EXIT_FAILURE);
+	}
+	context.output.write(printed);
+	context.output.flush();
+	if (status != 0)
+		exit(EXIT_FAILURE);
 }
 
+//	every record starts from a fresh scope, so records don't see each other
+//	and can run in any order. a round of lines is cut into shards that the
+//	worker pool runs, each worker with its own interpreter and each shard
+//	printing into its own buffer, written out in input order afterwards
+void Vous::runBatch(const std::string& path, const std::vector<std::string>& inputs)
+{
+	const size_t shardLines = 1024;
+	const size_t roundLines = shardLines * 4 * options.threads;
+
+	Scanner scanner(readFile(path), context);
+	std::vector<Token> tokens = scanner.scanTokens();
+	Parser parser(tokens, context);
+	std::vector<std::unique_ptr<Stmt>> statements = parser.parse();
+	if (context.hadError)
+	{
+		context.output.flush();
+		exit(EXIT_FAILURE);
+	}
+
+	Effects effects;
+	for (const auto& statement : statements)
+		effects.addStmt(*statement);
+	if (effects.input)
+	{
+		context.output.write("Scripts run once per record can't read input.\n");
+		context.output.flush();
+		exit(EXIT_FAILURE);
+	}
+
+	if (options.optimize)
+		Optimizer().optimize(statements, parser.views());
+	EventTable events;
+	events.build(statements, parser.events().size(), parser.views(), options.optimize);
+
+	std::unique_ptr<WorkerPool> pool;
+	if (options.threads > 1)
+		pool = std::make_unique<WorkerPool>(options.threads);
+	std::vector<std::unique_ptr<Interpreter>> runners;
+	for (unsigned i = 0; i < options.threads; i++)
+		runners.push_back(std::make_unique<Interpreter>(context));
+
+	std::vector<std::string_view> records;
+	std::vector<std::string> printed;
+	std::vector<char> failed;
+	int64_t number = 0;
+	auto runRound = [&]()
+	{
+		size_t shards = (records.size() + shardLines - 1) / shardLines;
+		printed.assign(shards, std::string());
+		failed.assign(shards, false);
+		auto task = [&](size_t shard, unsigned worker)
+		{
+			Output out(printed[shard]);
+			const Interpreter& runner = *runners[worker];
+			runner.useOutput(out);
+			size_t last = std::min(records.size(), (shard + 1) * shardLines);
+			for (size_t i = shard * shardLines; i < last; i++)
+			{
+				runner.startRecord(records[i], number + i + 1);
+				if (!runner.interpret(statements, events))
+					failed[shard] = true;
+			}
+			out.flush();
+		};
+		if (pool != nullptr)
+			pool->run(shards, task);
+		else
+			for (size_t shard = 0; shard < shards; shard++)
+				task(shard, 0);
+
+		for (size_t shard = 0; shard < shards; shard++)
+		{
+			context.output.write(printed[shard]);
+			context.hadRuntimeError = context.hadRuntimeError || failed[shard];
+		}
+		number += records.size();
+		records.clear();
+	};
+
+	std::vector<std::string> files = inputs;
+	if (files.empty())
+		files.push_back("");
+	for (const auto& file : files)
+	{
+		Input opened;
+		Input& in = file.empty() ? context.input : opened;
+		if (!file.empty() && !opened.open(file))
+		{
+			context.output.write("Error opening file " + file + "\n");
+			context.hadRuntimeError = true;
+			continue;
+		}
+
+		std::string_view lines;
+		while (in.readLines(lines, Input::blockSize / 2))
+		{
+			while (!lines.empty())
+			{
+				size_t end = lines.find('\n');
+				records.push_back(lines.substr(0, end));
+				lines.remove_prefix(end == std::string_view::npos ? lines.size() : end + 1);
+				if (records.size() == roundLines)
+					runRound();
+			}
+			//	the views point into the block, which the next read replaces
+			runRound();
+		}
+	}
 
+	context.output.flush();
+	if (context.hadRuntimeError)
+		exit(EXIT_FAILURE);
+}
@@ -1,29 +1,43 @@
 #pragma once
-#pragma once
 #include <string>
 #include <fstream>
 #include <sstream>
 #include <iostream>
 #include <vector>
 #include "token.h"
-#include "Scanner.h"
+#include "scanner.h"
 #include "interpreter.h"
+#include "options.h"
+#include "context.h"
 
+//	an interpreter with its own context and global scope. nothing is shared
+//	between instances, so an embedding program can run independent scripts
+//	on separate threads, one instance each
 class Vous
 {
 public:
-	Vous();
-	static bool hadError;
-	static bool hadRuntimeError;
-	static void error(int line, std::string message);
-	static void error(Token token, std::string message);
-	static void runtimeError(Token token, std::string message);
+	explicit Vous(Options options = Options());
+	//	embedded: what scripts print is collected in sink, input expressions
+	//	read the lines of text
+	Vous(Options options, std::string& sink, std::string_view text = std::string_view());
 
+	//	runs source in the instance's global scope, so later runs see what it
+	//	defined. false if it had a syntax or runtime error, which was printed
+	bool run(const std::string& source);
 	void runFile(const std::string& path);
 	void runPrompt();
+	//	runs the script once per line of the inputs, standard input if none
+	void runBatch(const std::string& path, const std::vector<std::string>& inputs);
+	//	sends the script and all of standard input to a server and prints
+	//	what it sends back
+	void runRemote(const std::string& server, const std::string& path);
+
+	//	error flags and the streams scripts print to and read from
+	Context context;
 
 private:
-	void run(std::string source);
-	static void report(int line, std::string location, std::string& message);
-	static const Interpreter interpreter;
+	void setup();
+	std::string readFile(const std::string& path);
+	Options options;
+	const Interpreter interpreter;
 };
@@ -0,0 +1,66 @@
+//	counts heap allocations made while a script runs and reports them per
+//	evaluated expression
+//
+//	g++ -std=c++17 -O2 -I../Evoke/Evoke alloc_count.cpp $(ls ../Evoke/Evoke/*.cpp | grep -v main.cpp) -o alloc_count
+//	./alloc_count expressions.vs
+
+#include <cstdlib>
+#include <new>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include "scanner.h"
+#include "parser.h"
+#include "optimizer.h"
+#include "interpreter.h"
+
+static unsigned long long allocations = 0;
+
+void* operator new(std::size_t size)
+{
+	allocations++;
+	if (void* memory = std::malloc(size))
+		return memory;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+	std::free(memory);
+}
+
+int main(int argc, const char* argv[])
+{
+	if (argc != 2)
+	{
+		std::cout << "Usage: alloc_count [script]\n";
+		return EXIT_FAILURE;
+	}
+
+	std::ifstream file(argv[1]);
+	std::stringstream buffer;
+	buffer << file.rdbuf();
+
+	Context context;
+	Scanner scanner(buffer.str(), context);
+	Parser parser(scanner.scanTokens(), context);
+	std::vector<std::unique_ptr<Stmt>> statements = parser.parse();
+	Optimizer().optimize(statements, parser.views());
+	EventTable events;
+	events.build(statements, parser.events().size(), parser.views());
+
+	Interpreter interpreter(context);
+	unsigned long long before = allocations;
+	interpreter.interpret(statements, events);
+	unsigned long long made = allocations - before;
+
+	std::cerr << "allocations: " << made << "\n"
+		<< "dispatches: " << interpreter.dispatchCount() << "\n"
+		<< "allocations per dispatch: " << double(made) / double(interpreter.dispatchCount()) << "\n";
+	return EXIT_SUCCESS;
+}
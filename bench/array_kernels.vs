@@ -0,0 +1,39 @@
+//	whole-array built-ins over packed numbers against the same work as loops
+//	vous --stats bench/array_kernels.vs, then again with kernels set to false
+var kernels = true;
+
+var[] xs;
+var[] ys;
+var n = 0;
+while (n < 1000000) { xs <- (n * 37) % 1000; ys <- n % 17; n = n + 1; }
+
+var total = 0;
+var low = 0;
+var high = 0;
+var product = 0;
+var round = 0;
+while (round < 10) {
+	if (kernels) {
+		scale(xs, 0.5);
+		offset(xs, 1);
+		total = total + sum(xs);
+		low = min(xs);
+		high = max(xs);
+		product = product + dot(xs, ys);
+	} else {
+		low = xs[0];
+		high = xs[0];
+		for (var i = 0; i < n; i = i + 1) {
+			xs[i] = xs[i] * 0.5 + 1;
+			total = total + xs[i];
+			if (xs[i] < low) low = xs[i];
+			if (xs[i] > high) high = xs[i];
+			product = product + xs[i] * ys[i];
+		}
+	}
+	round = round + 1;
+}
+print total;
+print low;
+print high;
+print product;
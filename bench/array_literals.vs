@@ -0,0 +1,32 @@
+//	array literals and [value; count] against filling the same arrays with pushes
+//	vous --stats bench/array_literals.vs with useLiterals set to true vs false
+var useLiterals = true;
+var total = 0;
+var round = 0;
+while (round < 20000) {
+	if (useLiterals) {
+		var[] small = [10, 1, 12, 13, 111, 11, 221, 14, 51, 15, 24, 20, 21, 12];
+		total = total + small[round % 14];
+	} else {
+		var[] small;
+		small <- 10; small <- 1; small <- 12; small <- 13; small <- 111; small <- 11; small <- 221;
+		small <- 14; small <- 51; small <- 15; small <- 24; small <- 20; small <- 21; small <- 12;
+		total = total + small[round % 14];
+	}
+	round = round + 1;
+}
+
+round = 0;
+while (round < 20) {
+	if (useLiterals) {
+		var[] zeros = [round; 50000];
+		total = total + sum(zeros);
+	} else {
+		var[] zeros;
+		var i = 0;
+		while (i < 50000) { zeros <- round; i = i + 1; }
+		total = total + sum(zeros);
+	}
+	round = round + 1;
+}
+print total;
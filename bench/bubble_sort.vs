@@ -0,0 +1,30 @@
+//	example.vs style bubble sort over a larger array
+//	vous --stats --no-opt bench/bubble_sort.vs
+//	vous --stats bench/bubble_sort.vs
+
+var[] array;
+var seed = 7;
+
+for(var k = 0; k < 300; k = k + 1)
+{
+	seed = (seed * 1103 + 12345) % 10007;
+	array <- seed;
+}
+
+for(var i = 0; i < 300; i = i + 1)
+{
+	for(var j = 0; j < 300 - i - 1; j = j + 1)
+	{
+		if(array[j] > array[j+1])
+		{
+			var temp = array[j];
+			array[j] = array[j+1];
+			array[j+1] = temp;
+		}
+	}
+}
+
+for(var i = 0; i < 300; i = i + 10)
+{
+	print array[i];
+}
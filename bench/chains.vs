@@ -0,0 +1,10 @@
+var a = 0; var b = 0; var k = 0;
+a = a + 1 : S;
+evoke P : S;
+evoke Q : P;
+b = b + a : Q;
+evoke R : Q;
+k = k + 1 : R;
+evoke S ?? k < 300000 : R;
+evoke S;
+print b;
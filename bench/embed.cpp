@@ -0,0 +1,80 @@
+//	independent scripts run on separate threads, one Vous instance each, with
+//	nothing shared between them. prints scripts per second for growing thread
+//	counts, which should scale with the cores
+//
+//	g++ -std=c++17 -O2 -pthread -I../Evoke/Evoke embed.cpp $(ls ../Evoke/Evoke/*.cpp | grep -v main.cpp) -o embed
+//	./embed [max threads]
+
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include "vous.h"
+
+static const int scriptsPerThread = 200;
+
+static const char* script =
+	"var[] a;\n"
+	"var i = 0;\n"
+	"while (i < 200) { a <- (i * 7) % 13; i = i + 1; }\n"
+	"var total = 0;\n"
+	"i = 0;\n"
+	"while (i < 200) { total = total + a[i]; i = i + 1; }\n"
+	"print total;\n"
+	"print input;\n";
+
+static double seconds(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, const char* argv[])
+{
+	unsigned maxThreads = argc > 1 ? std::atoi(argv[1]) : std::thread::hardware_concurrency();
+	if (maxThreads == 0)
+		maxThreads = 1;
+
+	std::string expected;
+	{
+		Vous vous(Options(), expected, "done\n");
+		vous.run(script);
+	}
+
+	double single = 0;
+	for (unsigned threads = 1; threads <= maxThreads; threads *= 2)
+	{
+		std::vector<std::thread> running;
+		std::vector<int> wrong(threads, 0);
+		auto start = std::chrono::steady_clock::now();
+		for (unsigned t = 0; t < threads; t++)
+		{
+			running.emplace_back([&wrong, &expected, t]()
+			{
+				for (int i = 0; i < scriptsPerThread; i++)
+				{
+					std::string printed;
+					{
+						Vous vous(Options(), printed, "done\n");
+						vous.run(script);
+					}
+					wrong[t] += printed != expected;
+				}
+			});
+		}
+		for (auto& thread : running)
+			thread.join();
+		double time = seconds(start);
+
+		int errors = 0;
+		for (int count : wrong)
+			errors += count;
+		double rate = threads * scriptsPerThread / time;
+		if (threads == 1)
+			single = rate;
+		std::cout << threads << " threads: " << rate << " scripts/s, " << rate / single << "x"
+			<< (errors ? " (wrong output)" : "") << "\n";
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,86 @@
+//	events per second through the pending event queue: batches posted and
+//	taken by one thread, posts of one event coalescing, and the worker pool
+//	posting through the shared path
+//
+//	g++ -std=c++17 -O2 -pthread -I../Evoke/Evoke event_queue.cpp ../Evoke/Evoke/eventqueue.cpp ../Evoke/Evoke/pool.cpp -o event_queue
+//	./event_queue [threads]
+
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include "eventqueue.h"
+#include "pool.h"
+
+static const int eventCount = 1024;
+static const size_t batch = 256;
+static const size_t rounds = 20000;
+
+static double seconds(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void report(const char* name, size_t events, double time, unsigned long long check)
+{
+	std::cout << name << ": " << events / time / 1e6 << " M events/s (check " << check << ")\n";
+}
+
+int main(int argc, const char* argv[])
+{
+	unsigned threads = argc > 1 ? std::atoi(argv[1]) : std::thread::hardware_concurrency();
+	if (threads < 1)
+		threads = 1;
+
+	EventQueue queue;
+	queue.reset(eventCount);
+	std::vector<PendingEvent> events(batch);
+	for (size_t i = 0; i < batch; i++)
+		events[i] = { static_cast<int>(i % eventCount), static_cast<unsigned>(i), nullptr };
+
+	//	distinct events, nothing coalesces
+	unsigned long long check = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (size_t round = 0; round < rounds; round++)
+	{
+		queue.push(events.data(), batch, 0);
+		for (size_t i = 0; i < queue.size(); i++)
+			check += queue[i].event;
+		queue.truncate(0);
+	}
+	report("single thread", rounds * batch, seconds(start), check);
+
+	//	the same event posted over and over stays one entry
+	check = 0;
+	PendingEvent same{ 7, 0, nullptr };
+	start = std::chrono::steady_clock::now();
+	for (size_t round = 0; round < rounds; round++)
+	{
+		for (size_t i = 0; i < batch; i++)
+			queue.push(same, 0);
+		check += queue.size();
+		queue.truncate(0);
+	}
+	report("coalesced", rounds * batch, seconds(start), check);
+
+	//	pool tasks post batches of 16, merged back into order after each round
+	WorkerPool pool(threads);
+	check = 0;
+	size_t tasks = batch / 16;
+	start = std::chrono::steady_clock::now();
+	for (size_t round = 0; round < rounds; round++)
+	{
+		queue.beginShared();
+		pool.run(tasks, [&](size_t index, unsigned)
+		{
+			queue.pushShared(events.data() + index * 16, 16);
+		});
+		queue.endShared(0);
+		check += queue.size();
+		queue.truncate(0);
+	}
+	std::cout << threads << " threads, ";
+	report("shared", rounds * batch, seconds(start), check);
+}
@@ -0,0 +1,20 @@
+//	event dispatch, a guarded repeat evoke firing a few subscribers per round
+//	with many other events subscribed so a lookup by name would have to search
+byte count = 0 : setup;
+byte total = 0 : setup;
+evoke setup;
+
+total = total + 1 : a0;
+total = total + 2 : a1;
+total = total + 3 : a2;
+total = total + 4 : a3;
+total = total + 5 : a4;
+total = total + 6 : a5;
+total = total + 7 : a6;
+total = total + 8 : a7;
+
+total = total + count : step;
+count = count + 1 : step;
+
+evoke step ?? count < 200000;
+print total;
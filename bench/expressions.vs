@@ -0,0 +1,18 @@
+//	expression heavy loop: arithmetic, comparisons and long string values
+//	that don't fit in a small string buffer
+
+var greeting = "a string value that is longer than the small string buffer";
+var copy = "";
+var matches = 0;
+var total = 0;
+
+for(var i = 0; i < 100000; i = i + 1)
+{
+	copy = greeting;
+	if(copy == greeting)
+		matches = matches + 1;
+	total = total + (i * 3 - 1) / 2 % 7;
+}
+
+print matches;
+print total;
@@ -0,0 +1,34 @@
+//	fan out, one event with eight subscribers that each update their own variable
+//	the subscribers touch disjoint names, so --parallel runs them side by side
+byte x = 1 : setup;
+byte round = 0 : setup;
+byte s0 = 0 : setup;
+byte s1 = 0 : setup;
+byte s2 = 0 : setup;
+byte s3 = 0 : setup;
+byte s4 = 0 : setup;
+byte s5 = 0 : setup;
+byte s6 = 0 : setup;
+byte s7 = 0 : setup;
+evoke setup;
+
+s0 = s0 + 0 + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) : work;
+s1 = s1 + 1 + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) : work;
+s2 = s2 + 2 + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) : work;
+s3 = s3 + 3 + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) : work;
+s4 = s4 + 4 + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) : work;
+s5 = s5 + 5 + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) : work;
+s6 = s6 + 6 + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) : work;
+s7 = s7 + 7 + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) + (x * 6 - 0) + (x * 7 - 1) + (x * 1 - 2) + (x * 2 - 3) + (x * 3 - 4) + (x * 4 - 0) + (x * 5 - 1) + (x * 6 - 2) + (x * 7 - 3) + (x * 1 - 4) + (x * 2 - 0) + (x * 3 - 1) + (x * 4 - 2) + (x * 5 - 3) + (x * 6 - 4) + (x * 7 - 0) + (x * 1 - 1) + (x * 2 - 2) + (x * 3 - 3) + (x * 4 - 4) + (x * 5 - 0) + (x * 6 - 1) + (x * 7 - 2) + (x * 1 - 3) + (x * 2 - 4) + (x * 3 - 0) + (x * 4 - 1) + (x * 5 - 2) + (x * 6 - 3) + (x * 7 - 4) + (x * 1 - 0) + (x * 2 - 1) + (x * 3 - 2) + (x * 4 - 3) + (x * 5 - 4) : work;
+round = round + 1 : next;
+evoke work : next;
+
+evoke next ?? round < 2000;
+print s0;
+print s1;
+print s2;
+print s3;
+print s4;
+print s5;
+print s6;
+print s7;
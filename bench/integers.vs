@@ -0,0 +1,20 @@
+//	integer arithmetic, '%' and the bitwise operators on 64 bit integers
+//	vous --stats bench/integers.vs against a build before integers, timed
+var x = 12345;
+var bits = 0;
+var odd = 0;
+var n = 0;
+while (n < 200000) {
+	x = (x * 1103515245 + 12345) & 2147483647;
+	var v = x;
+	while (v > 0) {
+		bits = bits + (v & 1);
+		v = v >> 1;
+	}
+	if (x % 2 == 1) odd = odd + 1;
+	n = n + 1;
+}
+print x;
+print bits;
+print odd;
+print (1 << 40) | (x << 8) | (x >> 24);
@@ -0,0 +1,24 @@
+//	loads a million numbers back from the files save and savebinary wrote, text
+//	parsed in chunks on the worker pool or the binary file mapped in place
+//	vous --stats bench/load.vs with binary set to true vs false, and with --parallel
+var binary = false;
+var n = 1000000;
+var[] data = [0; n];
+var i = 0;
+while (i < n) { data[i] = (i * 7919) % 100003 / 7; i = i + 1; }
+save(data, "load_bench.txt");
+savebinary(data, "load_bench.bin");
+
+var total = 0;
+var round = 0;
+while (round < 10) {
+	var[] loaded;
+	if (binary) {
+		loadbinary(loaded, "load_bench.bin");
+	} else {
+		load(loaded, "load_bench.txt");
+	}
+	total = total + sum(loaded);
+	round = round + 1;
+}
+print total;
@@ -0,0 +1,35 @@
+//	key to value lookups, a var{} map against parallel arrays scanned linearly
+//	vous --stats bench/map_lookup.vs, then again with useMap set to false
+
+var useMap = true;
+var size = 2000;
+var lookups = 200000;
+
+var{} counts;
+var[] keys;
+var[] values;
+for (var i = 0; i < size; i = i + 1) {
+	counts{i * 31} = 0;
+	keys <- i * 31;
+	values <- 0;
+}
+
+var seed = 7;
+for (var n = 0; n < lookups; n = n + 1) {
+	seed = (seed * 1103 + 12345) % 10007;
+	var key = (seed % size) * 31;
+	if (useMap) {
+		counts{key} = counts{key} + 1;
+	} else {
+		var j = 0;
+		while (keys[j] != key) j = j + 1;
+		values[j] = values[j] + 1;
+	}
+}
+
+var total = 0;
+for (var i = 0; i < size; i = i + 1) {
+	if (useMap) total = total + counts{i * 31} * i;
+	else total = total + values[i] * i;
+}
+print total;
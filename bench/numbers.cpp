@@ -0,0 +1,58 @@
+//	scans a literal heavy script and formats the numbers it holds, against the
+//	std::stod and std::to_string the interpreter used before
+//
+//	g++ -std=c++17 -O2 -I../Evoke/Evoke numbers.cpp $(ls ../Evoke/Evoke/*.cpp | grep -v main.cpp) -o numbers
+//	./numbers
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <iostream>
+#include "scanner.h"
+#include "numbers.h"
+
+static double milliseconds(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+	std::string source;
+	std::vector<std::string> lexemes;
+	for (int i = 0; i < 200000; i++)
+	{
+		std::string literal = std::to_string(i) + "." + std::to_string(i % 997);
+		source += "x = " + literal + " * 3 + " + std::to_string(i) + ";\n";
+		lexemes.push_back(literal);
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	Context context;
+	Scanner scanner(source, context);
+	size_t tokens = scanner.scanTokens().size();
+	std::cout << "scan " << tokens << " tokens: " << milliseconds(start) << " ms\n";
+
+	double sum = 0;
+	start = std::chrono::steady_clock::now();
+	for (const auto& lexeme : lexemes)
+		sum += std::stod(lexeme.substr(0));
+	std::cout << "std::stod: " << milliseconds(start) << " ms\n";
+
+	start = std::chrono::steady_clock::now();
+	for (const auto& lexeme : lexemes)
+		sum += parseNumber(lexeme.data(), lexeme.data() + lexeme.size());
+	std::cout << "parseNumber: " << milliseconds(start) << " ms\n";
+
+	size_t length = 0;
+	start = std::chrono::steady_clock::now();
+	for (int i = 0; i < 1000000; i++)
+		length += std::to_string(i / 8.0).size();
+	std::cout << "std::to_string: " << milliseconds(start) << " ms\n";
+
+	char text[maxNumberLength];
+	start = std::chrono::steady_clock::now();
+	for (int i = 0; i < 1000000; i++)
+		length += formatNumber(i / 8.0, text);
+	std::cout << "formatNumber: " << milliseconds(start) << " ms (check " << sum + length << ")\n";
+}
@@ -0,0 +1,24 @@
+//	map and reduce over an array with a parallel loop
+//	vous --stats bench/parallel_for.vs vs vous --stats --parallel bench/parallel_for.vs
+var[] samples;
+var n = 0;
+while (n < 400000) { samples <- (n * 7919) % 1000; n = n + 1; }
+
+var total = 0;
+var low = 1000;
+var high = 0;
+var round = 0;
+while (round < 5) {
+	parallel (+ total, min low, max high) for (var i = 0; i < n; i = i + 1) {
+		var x = samples[i] / 1000;
+		var y = x * x * 3 - x * 2 + 1;
+		samples[i] = y * 1000 % 1000;
+		total = total + y;
+		if (y < low) low = y;
+		if (y > high) high = y;
+	}
+	round = round + 1;
+}
+print total;
+print low;
+print high;
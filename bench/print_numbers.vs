@@ -0,0 +1,9 @@
+//	prints half a million numbers, integers and fractions, run with the output
+//	sent to a file or /dev/null so the terminal isn't what is measured
+var i = 0;
+while (i < 250000)
+{
+	print i;
+	print i / 8;
+	i = i + 1;
+}
@@ -0,0 +1,94 @@
+//	many derived values recomputed on every evoke while their inputs rarely change
+var a = 1;
+var b = 2;
+var c = 3;
+var d0 = 0;
+var d1 = 0;
+var d2 = 0;
+var d3 = 0;
+var d4 = 0;
+var d5 = 0;
+var d6 = 0;
+var d7 = 0;
+var d8 = 0;
+var d9 = 0;
+var d10 = 0;
+var d11 = 0;
+var d12 = 0;
+var d13 = 0;
+var d14 = 0;
+var d15 = 0;
+var d16 = 0;
+var d17 = 0;
+var d18 = 0;
+var d19 = 0;
+var d20 = 0;
+var d21 = 0;
+var d22 = 0;
+var d23 = 0;
+var d24 = 0;
+var d25 = 0;
+var d26 = 0;
+var d27 = 0;
+var d28 = 0;
+var d29 = 0;
+var d30 = 0;
+var d31 = 0;
+var d32 = 0;
+var d33 = 0;
+var d34 = 0;
+var d35 = 0;
+var d36 = 0;
+var d37 = 0;
+var d38 = 0;
+var d39 = 0;
+d0 = a * 1 + b * c - 0 : update;
+d1 = a * 2 + b * c - 1 : update;
+d2 = a * 3 + b * c - 2 : update;
+d3 = a * 4 + b * c - 3 : update;
+d4 = a * 5 + b * c - 4 : update;
+d5 = a * 6 + b * c - 5 : update;
+d6 = a * 7 + b * c - 6 : update;
+d7 = a * 8 + b * c - 7 : update;
+d8 = a * 9 + b * c - 8 : update;
+d9 = a * 10 + b * c - 9 : update;
+d10 = a * 11 + b * c - 10 : update;
+d11 = a * 12 + b * c - 11 : update;
+d12 = a * 13 + b * c - 12 : update;
+d13 = a * 14 + b * c - 13 : update;
+d14 = a * 15 + b * c - 14 : update;
+d15 = a * 16 + b * c - 15 : update;
+d16 = a * 17 + b * c - 16 : update;
+d17 = a * 18 + b * c - 17 : update;
+d18 = a * 19 + b * c - 18 : update;
+d19 = a * 20 + b * c - 19 : update;
+d20 = a * 21 + b * c - 20 : update;
+d21 = a * 22 + b * c - 21 : update;
+d22 = a * 23 + b * c - 22 : update;
+d23 = a * 24 + b * c - 23 : update;
+d24 = a * 25 + b * c - 24 : update;
+d25 = a * 26 + b * c - 25 : update;
+d26 = a * 27 + b * c - 26 : update;
+d27 = a * 28 + b * c - 27 : update;
+d28 = a * 29 + b * c - 28 : update;
+d29 = a * 30 + b * c - 29 : update;
+d30 = a * 31 + b * c - 30 : update;
+d31 = a * 32 + b * c - 31 : update;
+d32 = a * 33 + b * c - 32 : update;
+d33 = a * 34 + b * c - 33 : update;
+d34 = a * 35 + b * c - 34 : update;
+d35 = a * 36 + b * c - 35 : update;
+d36 = a * 37 + b * c - 36 : update;
+d37 = a * 38 + b * c - 37 : update;
+d38 = a * 39 + b * c - 38 : update;
+d39 = a * 40 + b * c - 39 : update;
+var total = 0;
+var t = 0;
+while (t < 50000)
+{
+	evoke update;
+	t = t + 1;
+	if (t % 1000 == 0)
+		a = a + 1;
+}
+print d39;
@@ -0,0 +1,12 @@
+//	counts the lines on standard input and echoes every tenth one, feed it a
+//	large file both redirected (mapped) and through a pipe (block reads)
+var count = 0;
+var line = input;
+while (line != "")
+{
+	count = count + 1;
+	if (count % 10 == 0)
+		print line;
+	line = input;
+}
+print count;
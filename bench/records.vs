@@ -0,0 +1,11 @@
+//	run with --batch over a large line file, e.g. seq 1 2000000 > big.txt
+//	vous --batch bench/records.vs big.txt vs vous --batch --parallel bench/records.vs big.txt
+//	mixes the record number and keeps the records whose hash ends in 3,
+//	about one in ten
+var hash = recordNumber;
+var i = 0;
+while (i < 20) {
+	hash = (hash * 31 + i) % 1000003;
+	i = i + 1;
+}
+if (hash % 10 == 3) print record;
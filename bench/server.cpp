@@ -0,0 +1,46 @@
+//	request latency against a running server, for comparing with starting a
+//	process per script. start the server first with
+//	vous --serve=/tmp/vous.sock --parallel
+//
+//	g++ -std=c++17 -O2 -pthread -I../Evoke/Evoke server.cpp $(ls ../Evoke/Evoke/*.cpp | grep -v main.cpp) -o server
+//	./server /tmp/vous.sock [requests]
+//	time (for i in $(seq 1000); do vous bench/events.vs < /dev/null > /dev/null; done) for the process per script cost
+
+#include <chrono>
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include "server.h"
+
+static const char* script =
+	"var total = 0;\n"
+	"var i = 0;\n"
+	"while (i < 100) { total = total + i; i = i + 1; }\n"
+	"print total;\n";
+
+int main(int argc, const char* argv[])
+{
+	if (argc < 2)
+	{
+		std::cout << "Usage: server socket [requests]\n";
+		return EXIT_FAILURE;
+	}
+	int requests = argc > 2 ? std::atoi(argv[2]) : 10000;
+
+	std::string printed;
+	if (Server::submit(argv[1], script, "", printed) != 0)
+	{
+		std::cout << "No server on " << argv[1] << "\n";
+		return EXIT_FAILURE;
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < requests; i++)
+	{
+		printed.clear();
+		Server::submit(argv[1], script, "", printed);
+	}
+	double time = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+	std::cout << requests << " requests: " << time / requests << " us each (" << printed.size() << " bytes back)\n";
+	return EXIT_SUCCESS;
+}
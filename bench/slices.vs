@@ -0,0 +1,25 @@
+//	sums over windows of an array through slice views against copying each window out with pushes
+//	vous --stats bench/slices.vs with useViews set to true vs false
+var useViews = true;
+var n = 20000;
+var width = 500;
+var[] data = [0; n];
+var i = 0;
+while (i < n) { data[i] = i % 97; i = i + 1; }
+
+var total = 0;
+var first = 0;
+while (first + width <= n) {
+	if (useViews) {
+		var[] window = data[first:first + width];
+		total = total + sum(window);
+	} else {
+		var[] window;
+		reserve(window, width);
+		var j = first;
+		while (j < first + width) { window <- data[j]; j = j + 1; }
+		total = total + sum(window);
+	}
+	first = first + 50;
+}
+print total;
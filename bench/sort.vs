@@ -0,0 +1,20 @@
+//	built-in sort over the same kind of data as bubble_sort.vs, scaled up
+//	vous --stats bench/sort.vs vs vous --stats --parallel bench/sort.vs
+//	set size to 300 to compare with vous --stats bench/bubble_sort.vs
+
+var size = 2000000;
+var[] array;
+var seed = 7;
+
+for(var k = 0; k < size; k = k + 1)
+{
+	seed = (seed * 1103 + 12345) % 10007;
+	array <- seed;
+}
+
+sort(array);
+
+for(var i = 0; i < size; i = i + size / 30)
+{
+	print array[i];
+}
@@ -0,0 +1,48 @@
+//	built-in functions over whole arrays, lengths that aren't a multiple of
+//	the vector width leave a tail the kernels handle on their own
+var[] a = [0; 1003];
+for (var i = 0; i < len(a); i = i + 1) a[i] = (i * 7919) % 1009 - 500;
+print len(a);
+print sum(a);
+print min(a);
+print max(a);
+var[] b = [0.5; 1003];
+print dot(a, b);
+print dot(b, b);
+scale(b, 4);
+print sum(b);
+offset(b, -1.5);
+print sum(b);
+print min(b) == max(b);
+fill(b, 3);
+print sum(b);
+//	a copy doesn't share its elements with the original
+var[] c;
+copy(c, a);
+offset(c, 1);
+print sum(c) - sum(a);
+print a[0];
+print c[0];
+copy(c, c);
+print len(c);
+//	the functions that change an array give its length
+print fill(c, 0.25);
+print sum(c);
+var[] short = [1, 2, 3];
+print copy(short, b);
+print len(short);
+//	small arrays and a single element
+var[] one = [-2.5];
+print sum(one);
+print min(one);
+print max(one);
+print dot(one, one);
+var[] none;
+print sum(none);
+print len(none);
+//	anything but numbers is an error
+var[] words = ["a", "b"];
+fill(words, "c");
+print words[1];
+print len(words);
+print sum(words);
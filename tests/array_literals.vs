@@ -0,0 +1,31 @@
+//	arrays declared with a list of elements or with copies of one value
+var[] array = [10, 1, 12, 13, 111, 11, 221, 14, 51, 15, 24, 20, 21, 12];
+print array[0] + array[13];
+var x = 4;
+var[] computed = [x, x * 2, -x, "four"];
+print computed[1];
+print computed[2];
+print computed[3];
+var[] negative = [-1.5, -2];
+print negative[0] + negative[1];
+var[] zeros = [0; 5];
+zeros[4] = 7;
+print zeros[3];
+print zeros[4];
+var[] words = ["a"; 3];
+print words[2];
+var[] grown = [];
+reserve(grown, 100);
+for (var i = 0; i < 100; i = i + 1) grown <- i;
+print grown[99];
+//	each declaration gets elements of its own
+var[] first = [1, 2];
+var[] second = [1, 2];
+first[0] = 5;
+print second[0];
+for (var i = 0; i < 2; i = i + 1) {
+	var[] fresh = [1, 2];
+	print fresh[0];
+	fresh[0] = 9;
+}
+var[] bad = [0; -1];
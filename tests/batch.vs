@@ -0,0 +1,13 @@
+//	run once per line of batch.records with --batch, which sees the line as
+//	'record' and its number as 'recordNumber', counted from 1
+var seen = 0;
+seen = seen + 1;
+if (recordNumber % 500 == 0 || recordNumber == 1) {
+	print recordNumber;
+	print record;
+	print seen;
+}
+//	a failing record reports its error in its place, the others still run
+if (record == "bad") print recordNumber / 0;
+print "end" : done;
+if (recordNumber == 3000) evoke done;
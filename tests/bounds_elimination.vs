@@ -0,0 +1,26 @@
+//	counted loops over arrays, with the bounds proven at loop entry or left
+//	to the checked path when they can't be
+var[] a = [1, 2, 3, 4, 5];
+var total = 0;
+for (var i = 0; i < 5; i = i + 1) total = total + a[i];
+print total;
+for (var i = 1; i < 4; i = i + 1) a[i - 1] = a[i + 1] * 2;
+print a[0];
+print a[2];
+//	a fractional index is cut to a whole one
+var s = 0;
+for (var i = 0.5; i < 4; i = i + 1) s = s + a[i];
+print s;
+//	pushes inside the loop reach elements the entry check didn't see
+var[] g = [1];
+for (var i = 0; i < 5; i = i + 1) {
+	g <- i * 10;
+	s = g[i + 1];
+}
+print s;
+//	a step of two and an inclusive limit
+var evens = 0;
+for (var i = 0; i <= 4; i = i + 2) evens = evens + a[i];
+print evens;
+//	the limit reaches past the end, the elements before it still print
+for (var i = 0; i < 7; i = i + 1) print a[i];
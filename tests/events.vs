@@ -0,0 +1,39 @@
+//	subscribers run in the order they were written whenever their event is
+//	evoked, and not when the script reaches them
+var total = 0;
+print "first" : tick;
+total = total + 1 : tick;
+print "second" : tick;
+print "before";
+evoke tick;
+evoke tick;
+print total;
+//	an event nothing listens to does nothing
+evoke quiet;
+print "grow" : grow;
+total = total * 10 : grow;
+evoke grow;
+print total;
+//	'?' evokes once if its condition holds, '??' for as long as it holds
+evoke tick ? total > 100;
+evoke tick ? total < 100;
+print total;
+var steps = 0;
+steps = steps + 1 : step;
+evoke step ?? steps < 5;
+print steps;
+//	evoking from a subscriber runs the inner event before going on
+print "outer in" : outer;
+evoke inner : outer;
+print "outer out" : outer;
+print "inner" : inner;
+evoke outer;
+//	subscriptions are all known before the script starts, so the one below
+//	already ran with "outer" above
+print "again" : inner;
+evoke inner;
+//	errors in a subscriber stop the script where the event was evoked
+print undefinedName : broken;
+print "not yet";
+evoke broken;
+print "not reached";
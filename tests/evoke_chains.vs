@@ -0,0 +1,31 @@
+//	a conditional evoke repeats as a loop, however long it runs, and an
+//	event that evokes itself doesn't run out of stack
+var n = 0;
+n = n + 1 : count;
+evoke count ?? n < 1000000;
+print n;
+//	the condition is checked before every run, so a false one runs nothing
+evoke count ?? n < 10;
+print n;
+//	an event evoking itself while a condition holds
+var left = 200000;
+var sum = 0;
+sum = sum + left : down;
+left = left - 1 : down;
+evoke down ? left > 0 : down;
+evoke down;
+print sum;
+print left;
+//	chains through several events
+var hops = 0;
+hops = hops + 1 : a;
+evoke b ? hops < 30000 : a;
+hops = hops + 1 : b;
+evoke a : b;
+evoke a;
+print hops;
+//	an error deep in a chain names the line it's on
+var k = 5;
+k = k - 1 : fall;
+print 10 / k : fall;
+evoke fall ?? true;
@@ -0,0 +1,18 @@
+//	expressions evaluate the same however deeply they nest and whatever types
+//	they carry
+print 1 + 2 * 3 - 4 / 2;
+print (1 + 2) * (3 - 4) / 2;
+print -(2 - 5) * -1;
+print 7 % 3;
+print 2 < 3 == true;
+print !(1 > 2) && (3 >= 3 || false);
+print "ab" + "cd";
+print 1 == "1";
+var a = 5;
+var b = a * a - (a + a) / (a - 3);
+print b;
+print b == 20 && true;
+print !true == false;
+print ((((((((a))))))));
+print a * 2 > a + 2 && a - 2 < a / 2 + 3;
+print "n = " + 4;
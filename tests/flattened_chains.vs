@@ -0,0 +1,41 @@
+//	an event evoked without a condition is run in place of the evoke, the
+//	order of everything that prints stays the one the script describes
+print "a1" : a;
+evoke b : a;
+print "a2" : a;
+evoke c : a;
+print "a3" : a;
+print "b1" : b;
+evoke c : b;
+print "b2" : b;
+print "c" : c;
+evoke a;
+//	evoking one directly still runs just its own list
+evoke b;
+//	an event reached twice in a chain runs twice
+print "twice" : d;
+evoke e : d;
+evoke e : d;
+print "e" : e;
+evoke d;
+//	a loop through the graph behind a condition runs until it's false
+var n = 0;
+n = n + 1 : ping;
+evoke pong : ping;
+print n : pong;
+evoke ping ? n < 4 : pong;
+evoke ping;
+//	a later subscriber sees what an inlined one did
+var total = 1;
+total = total * 3 : triple;
+evoke triple : grow;
+evoke triple : grow;
+total = total + 1 : grow;
+evoke grow;
+print total;
+//	errors in an inlined subscriber are reported at its own line
+print "start" : fail;
+evoke broken : fail;
+print "not reached" : fail;
+print 1 / 0 : broken;
+evoke fail;
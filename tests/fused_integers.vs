@@ -0,0 +1,31 @@
+//	fused compares and increments give the same results as the tree they
+//	replace, with integers past 2^53
+var x = 9007199254740992;
+print x < 9007199254740993;
+var y = 0;
+y = y + 9007199254740993;
+print y;
+var w = 0 + 9007199254740993;
+print w;
+var z = 9223372036854775807;
+print z > 9223372036854775806;
+z = z - 1;
+print z;
+z = z + 1;
+print z;
+z = z + 1;
+print z;
+var d = 0.5;
+d = d + 1;
+print d;
+print d < 2;
+var n = 9007199254740993;
+print n >= 9007199254740993.0;
+var[] a = [3, 1, 2];
+var i = 0;
+while (i < 2) {
+	if (a[i] > a[i + 1]) print i;
+	i = i + 1;
+}
+var big = 4611686018427387904;
+if (a[big] > a[big + 1]) print big;
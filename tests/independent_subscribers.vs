@@ -0,0 +1,36 @@
+//	subscribers touching different names may run at once with --parallel,
+//	what they leave behind is the same as running them in order
+var a = 0;
+var b = 0;
+var c = 2;
+var d = 1;
+var[] squares = [0; 8];
+var i = 0;
+a = a + 3 : fan;
+b = b + c * c : fan;
+d = d + 2 : fan;
+var e = 42 : fan;
+evoke fan;
+print a;
+print b;
+print d;
+print e;
+//	a chain evoking them many times still adds up
+evoke fan ?? a < 30000;
+print a;
+print b;
+print d;
+//	one that reads what another writes keeps them in order
+a = 1 : chained;
+b = a + 1 : chained;
+c = b + 1 : chained;
+squares[i] = i * i : chained;
+i = i + 1 : chained;
+d = squares[i - 1] + c : chained;
+evoke chained ?? i < 8;
+print a;
+print b;
+print c;
+print d;
+print i;
+print squares[7] + squares[3];
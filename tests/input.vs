@@ -0,0 +1,26 @@
+//	reads input.input a line at a time, lines come without their '\n' and
+//	an empty string is all that's left once the input runs out
+print input;
+var empty = input;
+print empty == "";
+print input;
+var long = input;
+var xs = "x";
+for (var i = 0; i < 12; i = i + 1) xs = xs + xs;
+print long == xs;
+//	counted while the lines are numbers
+var count = 0;
+var line = input;
+while (line != "last without newline") {
+	count = count + 1;
+	line = input;
+}
+print count;
+print line;
+print input == "";
+print input == "";
+//	an input read by a subscriber happens each time it runs
+var got = "" : read;
+got = input : read;
+evoke read;
+print got == "";
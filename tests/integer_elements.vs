@@ -0,0 +1,36 @@
+//	integer elements and indexes stay exact on the fused and the generic path
+//	an integer a double can't hold boxes the array from the start, so the
+//	others stay integers too
+var[] b = [9007199254740993, 94906267, 94906266];
+var i = 1;
+while (i < 2) {
+	if (b[i] > b[i + 1]) print b[i] * b[i];
+	i = i + 1;
+}
+var[] c = [9007199254740993, 9007199254740992];
+i = 0;
+while (i < 1) {
+	if (c[i] > c[i + 1]) print "exact";
+	i = i + 1;
+}
+var index = 1;
+print b[index];
+print b[1.9];
+print b[-0.5];
+//	'==' and map keys agree on integers a double can't hold
+print 9007199254740993 == 9007199254740992.0;
+print 9007199254740992 == 9007199254740992.0;
+var{} m;
+m{9007199254740993} = 1;
+print 9007199254740992.0 in m;
+print 9007199254740993 in m;
+//	sorted by exact value, an integer before the double that equals it
+var[] sorted = [9007199254740993, 3, 9007199254740992.0, -1, 9007199254740992, 0.0 * -1, 0, 2.5];
+sort(sorted);
+print sorted[0];
+print sorted[2];
+print sorted[3];
+print sorted[7];
+print sorted[5] + 1;
+print sorted[6] + 1;
+print b[10000000000];
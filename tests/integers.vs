@@ -0,0 +1,33 @@
+//	whole numbers are 64 bit integers while the result fits, with bitwise
+//	operators and shifts
+print 12 & 10;
+print 12 | 3;
+print 0 - 1 & 255;
+print 1 << 62;
+print 1 << 63;
+print 3 << 62;
+print 0 - 16 >> 2;
+print 9223372036854775807 >> 62;
+print 5 | 2 == 7;
+//	whole doubles take part as integers, other numbers don't
+print 6.0 & 3;
+print 9007199254740993 | 0;
+//	a quotient without remainder stays an integer
+print 9007199254740993 / 1;
+print 7 / 2;
+print 0 - 7 % 3;
+print 9223372036854775807 % 10;
+//	overflow falls back to doubles instead of wrapping
+print 9223372036854775807 + 1;
+print 0 - 9223372036854775807 - 1;
+print 0 - 9223372036854775807 - 2;
+print 4294967296 * 4294967296;
+print 3037000499 * 3037000499;
+//	exact comparisons and equality beyond 2^53
+print 9007199254740993 > 9007199254740992;
+print 9007199254740993 == 9007199254740992.0;
+print 9007199254740992 == 9007199254740992.0;
+var count = 0;
+for (var i = 9007199254740990; i < 9007199254740995; i = i + 1) count = count + 1;
+print count;
+print 1 << 64;
@@ -0,0 +1,43 @@
+//	arrays saved as text and as raw doubles read back unchanged, the files
+//	are left behind as load_save*.tmp for run.sh to remove
+var[] a = [0; 1000];
+for (var i = 0; i < len(a); i = i + 1) a[i] = i / 7 - 50;
+a[0] = 0.1 + 0.2;
+a[1] = 0.0 * -1;
+print save(a, "load_save.tmp");
+var[] text;
+print load(text, "load_save.tmp");
+var same = true;
+for (var i = 0; i < len(a); i = i + 1) if (a[i] != text[i]) same = false;
+print same;
+print text[0];
+print text[1];
+print savebinary(a, "load_save.bin.tmp");
+var[] binary;
+print loadbinary(binary, "load_save.bin.tmp");
+same = true;
+for (var i = 0; i < len(a); i = i + 1) if (a[i] != binary[i]) same = false;
+print same;
+print sum(binary) == sum(a);
+//	a loaded binary file can be written and grown like any array
+binary[5] = 12345;
+binary <- 1;
+print len(binary);
+print binary[5];
+var[] again;
+loadbinary(again, "load_save.bin.tmp");
+print again[5] == a[5];
+//	loading replaces what the array held, views of it keep their elements
+var[] part = again[0:2];
+var[] empty;
+save(empty, "load_save.empty.tmp");
+print load(again, "load_save.empty.tmp");
+print len(part);
+//	saving a view writes its range only
+var[] range = a[10:13];
+save(range, "load_save.range.tmp");
+print load(text, "load_save.range.tmp");
+print text[2] == a[12];
+//	a file that isn't numbers
+var[] wrong;
+load(wrong, "load_save.vs");
@@ -0,0 +1,45 @@
+//	expressions hoisted out of loops and reused within a block give the values
+//	they'd have if evaluated where they're written
+var x = 6;
+var y = 7;
+var total = 0;
+for (var i = 0; i < 4; i = i + 1) total = total + x * y + i;
+print total;
+//	an invariant that would fail is only an error when the loop body runs it
+var zero = 0;
+var never = 0;
+for (var i = 0; i < 3; i = i + 1) {
+	if (i > 5) never = x / zero;
+}
+print never;
+//	a value the loop writes isn't invariant
+var grow = 1;
+var sum = 0;
+for (var i = 0; i < 4; i = i + 1) {
+	sum = sum + grow * 2;
+	grow = grow + 1;
+}
+print sum;
+//	the same expression again after one of its inputs changed
+var[] a = [1, 2, 3];
+var j = 1;
+var before = a[j] * 10;
+a[j] = 5;
+var after = a[j] * 10;
+print before;
+print after;
+//	writes to a neighbouring element don't disturb a reused one
+var[] b = [1, 2, 3, 4, 5];
+var kept = 0;
+for (var k = 1; k < 4; k = k + 1) {
+	var left = b[k - 1] + b[k];
+	b[k + 1] = left;
+	kept = kept + b[k - 1] + b[k];
+}
+print kept;
+print b[4];
+//	once the body does run it, the error comes from where it's written
+for (var i = 0; i < 3; i = i + 1) {
+	if (i == 2) never = x / zero;
+	print i;
+}
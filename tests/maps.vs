@@ -0,0 +1,52 @@
+//	map keys are numbers, strings or booleans, each kind its own key
+var{} m;
+m{1} = "one";
+m{"1"} = "string one";
+m{true} = "yes";
+print m{1};
+print m{"1"};
+print m{true};
+print false in m;
+//	a number is the same key however it was written, 0 and -0 included
+print m{1.0};
+m{2.0} = "two";
+print m{2};
+m{0} = "zero";
+print m{0.0 * -1};
+m{0.0 * -1} = "still zero";
+print m{0};
+//	assigning again replaces, delete removes
+m{1} = "uno";
+print m{1};
+delete m{1};
+print 1 in m;
+print "1" in m;
+delete m{1};
+//	enough keys to grow the table several times, and to remove half again
+var{} squares;
+for (var i = 0; i < 10000; i = i + 1) squares{i} = i * i;
+for (var i = 0; i < 10000; i = i + 2) delete squares{i};
+var found = 0;
+var total = 0;
+for (var i = 0; i < 10000; i = i + 1) {
+	if (i in squares) {
+		found = found + 1;
+		total = total + squares{i};
+	}
+}
+print found;
+print total;
+//	values can be anything
+var{} mixed;
+mixed{"list"} = 3;
+mixed{"list"} = mixed{"list"} + 1;
+mixed{"flag"} = !true;
+print mixed{"list"};
+print mixed{"flag"};
+//	NaN is never equal to itself, so it can't be a key
+var huge = 1.0;
+for (var i = 0; i < 400; i = i + 1) huge = huge * 10;
+var nan = huge - huge;
+print nan in m;
+m{nan} = 1;
+print "not reached";
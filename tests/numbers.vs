@@ -0,0 +1,28 @@
+//	numbers print as the shortest text that reads back as the same value,
+//	whole ones without a fraction or an exponent
+print 0.1 + 0.2;
+print 0.1 + 0.2 == 0.30000000000000004;
+print 1.0 / 3;
+print 2.0 / 3 == 0.6666666666666666;
+print 0.5;
+print 100.0;
+print 1.5 * 4;
+print 0.000001;
+print 0.0000001;
+print 123456789.125;
+print 0.0 - 0.0;
+print 0.0 * -1;
+//	below 2^53 whole numbers are exact and print in full
+print 9007199254740991.0;
+print 9007199254740992.0;
+print 9007199254740993.0;
+var big = 1.0;
+for (var i = 0; i < 21; i = i + 1) big = big * 10;
+print big;
+print 1.0 / big;
+//	a literal too long for 64 bits is read as a double
+print 99999999999999999999;
+print 99999999999999999999 == 100000000000000000000;
+//	integer literals stay exact past 2^53
+print 9007199254740993;
+print 9007199254740993 + 2;
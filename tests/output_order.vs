@@ -0,0 +1,8 @@
+//	more than a buffer's worth of output comes out whole and in order, and an
+//	error that follows it comes after the last line printed
+var line = "................................................................";
+for (var i = 0; i < 1200; i = i + 1) print line + "";
+print "event" : said;
+for (var i = 0; i < 3; i = i + 1) evoke said;
+print "last";
+print 1 / 0;
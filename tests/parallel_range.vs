@@ -0,0 +1,10 @@
+//	parallel loop ranges, an empty one runs nothing and one too long to count
+//	is an error instead of silently running nothing
+var s = 0;
+parallel (+ s) for (var i = 10; i < 0; i = i + 1) { s = s + 1; }
+print s;
+parallel (+ s) for (var i = 0; i < 2.5; i = i + 1) { s = s + 1; }
+print s;
+var n = 1000000000000000000000;
+parallel (+ s) for (var i = 0; i < n * 1.5; i = i + 1) { s = s + 1; }
+print s;
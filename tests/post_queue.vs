@@ -0,0 +1,30 @@
+//	'emit' is another spelling of 'evoke' and runs the event right away,
+//	'post' queues it until the event posting it has finished
+var n = 0;
+print "inner" : inner;
+print "outer start" : now;
+emit inner : now;
+print "outer end" : now;
+evoke now;
+print "outer start" : later;
+post inner : later;
+print "outer end" : later;
+evoke later;
+//	posting an event that is already waiting adds nothing
+n = n + 1 : count;
+post count : twice;
+post count : twice;
+evoke twice;
+print n;
+//	a '?' guard is checked when posting, a '??' guard when the event runs
+var flag = false;
+print "guarded" : guarded;
+post guarded ? flag : check;
+flag = true : check;
+evoke check;
+var left = 0;
+left = left - 1 : countdown;
+print left : countdown;
+post countdown ?? left > 0 : start;
+left = 2 : start;
+evoke start;
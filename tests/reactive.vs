@@ -0,0 +1,62 @@
+//	with --reactive a subscriber whose inputs haven't changed since it last
+//	ran is skipped, which has to leave the same state behind as running it
+var y = 2;
+var x = 0;
+x = y + 1 : update;
+evoke update;
+print x;
+//	something else overwrote what it wrote, so it can't be skipped
+x = 100;
+evoke update;
+print x;
+//	an input that changed makes it run again
+y = 5;
+evoke update;
+print x;
+//	a subscriber reading its own result always changes it
+var n = 0;
+n = n + 1 : count;
+evoke count;
+evoke count;
+evoke count;
+print n;
+//	output happens every time
+print "shown" : show;
+evoke show;
+evoke show;
+//	array elements and maps are inputs too
+var[] a = [1, 2, 3];
+var{} m;
+m{"k"} = 1;
+var s = 0;
+s = a[1] + m{"k"} : read;
+evoke read;
+print s;
+a[1] = 20;
+evoke read;
+print s;
+m{"k"} = 30;
+evoke read;
+print s;
+a <- 4;
+s = len(a) : size;
+evoke size;
+print s;
+a <- 5;
+evoke size;
+print s;
+delete m{"k"};
+var has = true;
+has = "k" in m : check;
+evoke check;
+print has;
+m{"k"} = 0;
+evoke check;
+print has;
+//	a declaration defines the name again each time
+var d = y * 2 : define;
+evoke define;
+print d;
+d = 0;
+evoke define;
+print d;
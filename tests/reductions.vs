@@ -0,0 +1,25 @@
+//	the update shapes a reduction accepts give the sequential result
+var[] a = [0; 1000];
+var i = 0;
+while (i < 1000) { a[i] = (i * 37) % 101; i = i + 1; }
+var total = 0;
+var product = 1;
+var low = 1000;
+var high = -1;
+parallel (+ total, * product, min low, max high) for (var i = 0; i < 1000; i = i + 1) {
+	total = total + a[i] + 1;
+	if (i < 20) product = product * 2;
+	if (a[i] < low) low = a[i];
+	if (high <= (a[i])) { high = a[i]; }
+}
+print total;
+print product;
+print low;
+print high;
+var outer = 0;
+parallel (+ outer) for (var i = 0; i < 300; i = i + 1) {
+	var local = i;
+	local = local * 2;
+	parallel (+ outer) for (var j = 0; j < 3; j = j + 1) { outer = outer + local; }
+}
+print outer;
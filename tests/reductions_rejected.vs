@@ -0,0 +1,19 @@
+//	reductions written or read other than as the update of their kind
+var g = 1;
+var h = 5;
+var k = 0;
+var low = 100;
+var high = 0;
+parallel (+ g) for (var i = 0; i < 10; i = i + 1) { g = g * 2; }
+parallel (+ h) for (var i = 0; i < 10; i = i + 1) { h = 7; }
+parallel (+ k) for (var i = 0; i < 10; i = i + 1) { print k; }
+parallel (+ k) for (var i = 0; i < 10; i = i + 1) { k = k + k; }
+parallel (+ k) for (var i = 0; i < 10; i = i + 1) { var x = k; }
+parallel (* k) for (var i = 0; i < 10; i = i + 1) { k = k + i; }
+parallel (min low) for (var i = 0; i < 10; i = i + 1) { if (i > low) low = i; }
+parallel (min low) for (var i = 0; i < 10; i = i + 1) { if (i < low) low = i + 1; }
+parallel (max high) for (var i = 0; i < 10; i = i + 1) { high = i; }
+parallel (max high) for (var i = 0; i < 10; i = i + 1) { if (i > high) high = i; else high = 0; }
+parallel (+ k) for (var i = 0; i < 10; i = i + 1) {
+	parallel (max k) for (var j = 0; j < 10; j = j + 1) { if (j > k) k = j; }
+}
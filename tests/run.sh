@@ -0,0 +1,56 @@
+#!/bin/sh
+#	runs every script here with the interpreter given, by default the one in
+#	the build folder, in each mode and compares what it prints, errors
+#	included, with the .expected file next to it. a script reads the .input
+#	file next to it if there is one, nothing otherwise, and when there is a
+#	.records file it runs once per line of it in batch mode. a .repl file is
+#	typed into the prompt instead, a session outlives runtime errors so it
+#	shows what state a failing run leaves behind. last the scripts are sent
+#	to a server, which has to print the same. files scripts write are named
+#	*.tmp and removed at the end
+#	tests/run.sh [path to vous]
+vous=${1:-vous}
+cd "$(dirname "$0")"
+failed=0
+for script in *.vs; do
+	input=/dev/null
+	[ -f "${script%.vs}.input" ] && input="${script%.vs}.input"
+	records=
+	[ -f "${script%.vs}.records" ] && records="${script%.vs}.records"
+	for mode in "" --no-opt --parallel=4 --reactive; do
+		if ! "$vous" ${records:+--batch} $mode "$script" $records < "$input" 2>&1 | cmp -s - "${script%.vs}.expected"; then
+			echo "FAIL $script $mode"
+			failed=1
+		fi
+	done
+done
+for session in *.repl; do
+	for mode in "" --no-opt --parallel=4 --reactive; do
+		if ! "$vous" $mode < "$session" 2>&1 | cmp -s - "${session%.repl}.expected"; then
+			echo "FAIL $session $mode"
+			failed=1
+		fi
+	done
+done
+socket=$(mktemp -u "${TMPDIR:-/tmp}/vous.XXXXXX")
+"$vous" --serve="$socket" --parallel=2 > /dev/null 2>&1 &
+server=$!
+tries=0
+while [ ! -S "$socket" ] && [ $tries -lt 50 ]; do
+	sleep 0.1
+	tries=$((tries + 1))
+done
+for script in *.vs; do
+	#	batch mode runs locally only
+	[ -f "${script%.vs}.records" ] && continue
+	input=/dev/null
+	[ -f "${script%.vs}.input" ] && input="${script%.vs}.input"
+	if ! "$vous" --connect="$socket" "$script" < "$input" 2>&1 | cmp -s - "${script%.vs}.expected"; then
+		echo "FAIL $script --connect"
+		failed=1
+	fi
+done
+kill $server
+rm -f "$socket" *.tmp
+[ $failed = 0 ] && echo "all passed"
+exit $failed
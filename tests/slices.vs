@@ -0,0 +1,54 @@
+//	a slice is a view of a range of another array's elements, writes
+//	through either one show in the other
+var[] a = [0, 1, 2, 3, 4, 5, 6, 7, 8, 9];
+var[] middle = a[3:7];
+print len(middle);
+print middle[0];
+middle[1] = 40;
+print a[4];
+a[6] = 60;
+print middle[3];
+//	either bound can be left out
+var[] head = a[:2];
+var[] tail = a[8:];
+var[] all = a[:];
+print len(head);
+print tail[1];
+print len(all);
+//	the built-in functions see just the range
+print sum(middle);
+scale(middle, 2);
+print sum(a);
+sort(middle);
+print middle[0];
+fill(head, 0.5);
+print a[0] + a[1];
+//	a view of a view and an empty one
+var[] inner = middle[1:3];
+inner[0] = -1;
+print a[4];
+var[] none = a[5:5];
+print len(none);
+//	pushing onto a view makes it an array of its own
+tail <- 10;
+tail[0] = 80;
+print len(tail);
+print a[8];
+//	a copy is never a view
+var[] copied;
+copy(copied, middle);
+copied[0] = 1000;
+print a[3];
+//	copying into an array gives it new elements, a view keeps the old ones
+var[] grow = [1, 2, 3];
+var[] end = grow[1:3];
+copy(grow, head);
+print len(end);
+print end[1];
+//	strings and other values work the same way
+var[] words = ["a", "b", "c"];
+var[] last = words[2:];
+last[0] = "z";
+print words[2];
+//	bounds are checked when the slice is made
+var[] bad = a[4:11];
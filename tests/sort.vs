@@ -0,0 +1,38 @@
+//	sort puts numbers or strings in ascending order in place
+var[] small = [5, -2, 3.5, 0, -2, 10];
+sort(small);
+for (var i = 0; i < len(small); i = i + 1) print small[i];
+//	large enough to be split across workers with --parallel
+var[] big = [0; 100000];
+for (var i = 0; i < len(big); i = i + 1) big[i] = (i * 7919) % 100003 - 50000;
+var total = sum(big);
+sort(big);
+var ordered = true;
+for (var i = 1; i < len(big); i = i + 1) if (big[i - 1] > big[i]) ordered = false;
+print ordered;
+print sum(big) == total;
+print big[0];
+print big[99999];
+//	-0 before 0, infinities at the ends
+var huge = 1.0;
+for (var i = 0; i < 400; i = i + 1) huge = huge * 10;
+var[] edges = [0, huge, 0.0 * -1, 0 - huge, 1];
+sort(edges);
+for (var i = 0; i < len(edges); i = i + 1) print edges[i];
+//	strings compare byte by byte
+var[] words = ["pear", "Apple", "apple", "", "pea"];
+sort(words);
+for (var i = 0; i < len(words); i = i + 1) print words[i];
+//	sorted already, empty and single element arrays are left as they are
+sort(small);
+print small[0];
+var[] none;
+sort(none);
+print len(none);
+var[] one = ["x"];
+sort(one);
+print one[0];
+//	numbers and strings don't sort together
+var[] mixed = [1, "a"];
+sort(mixed);
+print "not reached";
@@ -0,0 +1,33 @@
+//	the loop shapes the optimizer fuses, and the operands that make the fused
+//	nodes fall back to the tree they replaced
+var count = 0;
+var i = 0;
+while (i < 10) {
+	count = count + 3;
+	i = i + 1;
+}
+print count;
+var down = 10;
+while (down > 0.5) down = down - 0.75;
+print down;
+//	a bubble sort, its inner compare is array[j] > array[j + 1]
+var[] a = [5, 3, 9, 1, 7, 2, 8];
+for (var pass = 0; pass < 7; pass = pass + 1) {
+	for (var j = 0; j < 6 - pass; j = j + 1) {
+		if (a[j] > a[j + 1]) {
+			var swap = a[j];
+			a[j] = a[j + 1];
+			a[j + 1] = swap;
+		}
+	}
+}
+print a[0];
+print a[3];
+print a[6];
+//	elements that aren't numbers fall back and fail as the tree does
+var[] words = ["pear", "fig", "apple"];
+var w = 0;
+while (w < 2) {
+	if (words[w] > words[w + 1]) print words[w];
+	w = w + 1;
+}